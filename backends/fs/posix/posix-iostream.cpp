@@ -24,6 +24,7 @@
 #include "backends/fs/posix/posix-iostream.h"
 
 #include <sys/stat.h>
+#include <fcntl.h>
 
 PosixIoStream::PosixIoStream(void *handle) :
 		StdioStream(handle) {
@@ -44,3 +45,21 @@ int64 PosixIoStream::size() const {
 
 	return st.st_size;
 }
+
+void PosixIoStream::prefetch(int64 offset, uint32 len) {
+	int fd = fileno((FILE *)_handle);
+	if (fd == -1 || offset < 0) {
+		return;
+	}
+
+	// Let the kernel read the range into the page cache asynchronously,
+	// a later read() of it then only has to copy from memory.
+#if defined(POSIX_FADV_WILLNEED)
+	posix_fadvise(fd, offset, len, POSIX_FADV_WILLNEED);
+#elif defined(F_RDADVISE)
+	struct radvisory ra;
+	ra.ra_offset = offset;
+	ra.ra_count = len;
+	fcntl(fd, F_RDADVISE, &ra);
+#endif
+}
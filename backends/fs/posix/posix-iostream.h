@@ -37,6 +37,7 @@ public:
 	PosixIoStream(void *handle);
 
 	int64 size() const override;
+	void prefetch(int64 offset, uint32 len) override;
 };
 
 #endif
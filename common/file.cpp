@@ -142,6 +142,11 @@ uint32 File::read(void *ptr, uint32 len) {
 	return _handle->read(ptr, len);
 }
 
+void File::prefetch(int64 offset, uint32 len) {
+	assert(_handle);
+	_handle->prefetch(offset, len);
+}
+
 
 DumpFile::DumpFile() : _handle(nullptr) {
 }
@@ -292,6 +292,15 @@ bool SeekableSubReadStream::seek(int64 offset, int whence) {
 	return ret;
 }
 
+void SeekableSubReadStream::prefetch(int64 offset, uint32 len) {
+	// Clip the range to the substream, the parent may extend beyond it
+	if (offset < 0 || offset >= size())
+		return;
+	len = MIN<int64>(len, size() - offset);
+
+	_parentStream->prefetch(_begin + offset, len);
+}
+
 uint32 SafeSeekableSubReadStream::read(void *dataPtr, uint32 dataSize) {
 	// Make sure the parent stream is at the right position
 	seek(0, SEEK_CUR);
@@ -441,6 +450,7 @@ public:
 	int64 size() const override { return _parentStream->size(); }
 
 	bool seek(int64 offset, int whence = SEEK_SET) override;
+	void prefetch(int64 offset, uint32 len) override { _parentStream->prefetch(offset, len); }
 };
 
 BufferedSeekableReadStream::BufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream)
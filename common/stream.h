@@ -792,6 +792,21 @@ public:
 	 */
 	virtual bool skip(uint32 offset) { return seek(offset, SEEK_CUR); }
 
+	/**
+	 * Hint that the given range of the stream is going to be read soon.
+	 *
+	 * Streams backed by a slow medium may use this to start fetching the
+	 * data in the background, so that a later read() of that range does
+	 * not block. This never changes the position indicator or the
+	 * end-of-stream and error flags, and it is always safe to ignore.
+	 *
+	 * The default implementation does nothing.
+	 *
+	 * @param offset	Start of the range, relative to the start of the stream.
+	 * @param len		Number of bytes in the range.
+	 */
+	virtual void prefetch(int64 offset, uint32 len) {}
+
 	/**
 	 * Read at most one less than the number of characters specified
 	 * by @p bufSize from the stream and store them in the string buffer.
@@ -86,6 +86,7 @@ public:
 	virtual int64 size() const { return _end - _begin; }
 
 	virtual bool seek(int64 offset, int whence = SEEK_SET);
+	virtual void prefetch(int64 offset, uint32 len);
 };
 
 /**
@@ -56,6 +56,7 @@ ScummVMRendererGraphicsDriver::ScummVMRendererGraphicsDriver() {
 ScummVMRendererGraphicsDriver::~ScummVMRendererGraphicsDriver() {
 	delete _screen;
 	ScummVMRendererGraphicsDriver::UnInit();
+	_lastPresented.free();
 }
 
 bool ScummVMRendererGraphicsDriver::IsModeSupported(const DisplayMode &mode) {
@@ -159,6 +160,7 @@ void ScummVMRendererGraphicsDriver::CreateVirtualScreen() {
 
 	_lastTexPixels = nullptr;
 	_lastTexPitch = -1;
+	InvalidatePresented();
 }
 
 void ScummVMRendererGraphicsDriver::DestroyVirtualScreen() {
@@ -173,6 +175,7 @@ void ScummVMRendererGraphicsDriver::DestroyVirtualScreen() {
 void ScummVMRendererGraphicsDriver::ReleaseDisplayMode() {
 	OnModeReleased();
 	ClearDrawLists();
+	InvalidatePresented();
 }
 
 bool ScummVMRendererGraphicsDriver::SetNativeResolution(const GraphicResolution &native_res) {
@@ -533,6 +536,50 @@ void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bo
 		_screen->addDirtyRect(Common::Rect(x1, y1, x2 + 1, y2 + 1));
 }
 
+void ScummVMRendererGraphicsDriver::InvalidatePresented() {
+	_lastPresented.free();
+	_lastPresentMode = -1;
+}
+
+Common::Rect ScummVMRendererGraphicsDriver::UpdatePresentedArea(const Graphics::Surface &src, int renderMode) {
+	const Common::Rect fullRect(src.w, src.h);
+	if (renderMode != _lastPresentMode || _lastPresented.w != src.w || _lastPresented.h != src.h ||
+			_lastPresented.format != src.format) {
+		// The target may not hold the previous frame, present everything
+		_lastPresented.copyFrom(src);
+		_lastPresentMode = renderMode;
+		return fullRect;
+	}
+
+	const int bpp = src.format.bytesPerPixel;
+	const int rowSize = src.w * bpp;
+	int x1 = src.w, y1 = -1, x2 = -1, y2 = -1;
+
+	for (int y = 0; y < src.h; ++y) {
+		const byte *srcRow = (const byte *)src.getBasePtr(0, y);
+		byte *lastRow = (byte *)_lastPresented.getBasePtr(0, y);
+		if (!memcmp(srcRow, lastRow, rowSize))
+			continue;
+
+		// Narrow down the changed columns on this row
+		int left = 0, right = src.w - 1;
+		while (left < x1 && !memcmp(srcRow + left * bpp, lastRow + left * bpp, bpp))
+			++left;
+		while (right > x2 && !memcmp(srcRow + right * bpp, lastRow + right * bpp, bpp))
+			--right;
+		x1 = MIN(x1, left);
+		x2 = MAX(x2, right);
+		if (y1 == -1)
+			y1 = y;
+		y2 = y;
+		memcpy(lastRow, srcRow, rowSize);
+	}
+
+	if (y1 == -1)
+		return Common::Rect();
+	return Common::Rect(x1, y1, x2 + 1, y2 + 1);
+}
+
 void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicFlip flip) {
 	Graphics::Surface *srcTransformed = nullptr;
 	if (xoff != 0 || yoff != 0 || flip != Shared::kFlip_None) {
@@ -586,6 +633,15 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 	if (renderMode != kRenderDirect && !_screen)
 		_screen = new Graphics::Screen();
 
+	// Mostly static screens (dialogs, inventory...) only change in small
+	// areas, so skip converting and uploading everything else. The ABGR and
+	// RGBA conversions already compare against the previous frame
+	Common::Rect dirtyRect;
+	if (renderMode == kRenderDirect || renderMode == kRenderOther)
+		dirtyRect = UpdatePresentedArea(src, renderMode);
+	else
+		InvalidatePresented();
+
 	switch (renderMode) {
 	case kRenderToABGR:
 		// ARGB to ABGR
@@ -603,14 +659,16 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		Graphics::Surface srcCopy = src;
 		srcCopy.format.aLoss = 8;
 
-		_screen->blitFrom(srcCopy);
+		if (!dirtyRect.isEmpty())
+			_screen->blitFrom(srcCopy, dirtyRect, Common::Point(dirtyRect.left, dirtyRect.top));
 		break;
 	}
 
 	case kRenderDirect:
-		// Blit the virtual surface directly to the screen
-		g_system->copyRectToScreen(src.getPixels(), src.pitch,
-			0, 0, src.w, src.h);
+		// Blit the changed area of the virtual surface directly to the screen
+		if (!dirtyRect.isEmpty())
+			g_system->copyRectToScreen(src.getBasePtr(dirtyRect.left, dirtyRect.top), src.pitch,
+				dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
 		g_system->updateScreen();
 		if (srcTransformed) {
 			srcTransformed->free();
@@ -250,6 +250,10 @@ protected:
 private:
 	Graphics::Screen *_screen = nullptr;
 	PSDLRenderFilter _filter;
+	// Copy of the last frame sent to the screen, used to only present
+	// the area that has changed since
+	Graphics::Surface _lastPresented;
+	int _lastPresentMode = -1;
 
 	bool _hasGamma = false;
 #ifdef TODO
@@ -291,6 +295,11 @@ private:
 	void DestroyVirtualScreen();
 	// Unset parameters and release resources related to the display mode
 	void ReleaseDisplayMode();
+	// Returns the area of src that differs from the last presented frame,
+	// and updates the copy of the latter
+	Common::Rect UpdatePresentedArea(const Graphics::Surface &src, int renderMode);
+	// Forces the next frame to be presented in full
+	void InvalidatePresented();
 	// Renders single sprite batch on the precreated surface
 	size_t RenderSpriteBatch(const ALSpriteBatch &batch, size_t from, Shared::Bitmap *surface, int surf_offx, int surf_offy);
 
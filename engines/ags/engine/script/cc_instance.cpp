@@ -561,6 +561,13 @@ int ccInstance::Run(int32_t curpc) {
 	funcstart[0] = pc;
 	ccInstance *codeInst = runningInst;
 	ScriptOperation codeOp;
+	// Instruction arguments are always plain integers, so only their values
+	// are updated when reading an operation; arguments that need a runtime
+	// fixup are resolved into a separate value instead
+	for (int i = 0; i < MAX_SCMD_ARGS; ++i)
+		codeOp.Args[i].SetInt32(0);
+	RuntimeScriptValue fixupArg;
+	ScriptCommands &commands = *g_commands;
 	FunctionCallStack func_callstack;
 #if DEBUG_CC_EXEC
 	const bool dump_opcodes = (ccGetOption(SCOPT_DEBUGRUN) != 0) ||
@@ -590,7 +597,7 @@ int ccInstance::Run(int32_t curpc) {
 		CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
 							"invalid instruction %d found in code stream", codeOp.Instruction.Code);
 
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
+		codeOp.ArgCount = commands[codeOp.Instruction.Code].ArgCount;
 
 		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
 							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
@@ -600,13 +607,13 @@ int ccInstance::Run(int32_t curpc) {
 
 		switch (codeOp.ArgCount) {
 		case 3:
-			codeOp.Args[2].SetInt32(static_cast<int32_t>(codeInst->code[pc + 3]));
+			codeOp.Args[2].IValue = static_cast<int32_t>(codeInst->code[pc + 3]);
 			/* fall-through */
 		case 2:
-			codeOp.Args[1].SetInt32(static_cast<int32_t>(codeInst->code[pc + 2]));
+			codeOp.Args[1].IValue = static_cast<int32_t>(codeInst->code[pc + 2]);
 			/* fall-through */
 		case 1:
-			codeOp.Args[0].SetInt32(static_cast<int32_t>(codeInst->code[pc + 1]));
+			codeOp.Args[0].IValue = static_cast<int32_t>(codeInst->code[pc + 1]);
 			break;
 		default:
 			break;
@@ -692,9 +699,10 @@ int ccInstance::Run(int32_t curpc) {
 			// be only up to 4 bytes large;
 			// I guess that's an obsolete way to do WRITE, WRITEW and WRITEB
 			const auto arg_size = codeOp.Arg1i();
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+			fixupArg.SetInt32(codeOp.Arg2i());
+			FixupArgument(fixupArg, codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
 			ASSERT_CC_ERROR();
-			const auto &arg_value = codeOp.Arg2();
+			const auto &arg_value = fixupArg;
 			switch (arg_size) {
 			case sizeof(char):
 				registers[SREG_MAR].WriteByte(arg_value.IValue);
@@ -729,9 +737,10 @@ int ccInstance::Run(int32_t curpc) {
 		}
 		case SCMD_LITTOREG: {
 			auto &reg1 = registers[codeOp.Arg1i()];
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+			fixupArg.SetInt32(codeOp.Arg2i());
+			FixupArgument(fixupArg, codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
 			ASSERT_CC_ERROR();
-			const auto &arg_value = codeOp.Arg2();
+			const auto &arg_value = fixupArg;
 			reg1 = arg_value;
 			break;
 		}
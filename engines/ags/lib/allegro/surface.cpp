@@ -208,6 +208,12 @@ void BITMAP::draw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 			drawInnerGeneric<2, 1, false>(args);
 		return;
 	}
+	// Opaque blits (e.g. room backgrounds and GUI surfaces) don't need to
+	// go through the blenders at all
+	if (args.sameFormat && !args.skipTrans && args.srcAlpha == -1) {
+		drawInnerCopy(args);
+		return;
+	}
 #ifdef SCUMMVM_NEON
 	if (_G(simd_flags) & AGS3::Globals::SIMD_NEON) {
 		drawNEON<false>(args);
@@ -272,6 +278,37 @@ void BITMAP::stretchDraw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 
 	delete stretched;
 }
+
+void BITMAP::drawInnerCopy(DrawInnerArgs &args) {
+	// Same clipping as drawInnerGeneric, without scaling or flipping
+	int xCtrStart = 0, xCtrWidth = args.dstRect.width();
+	if (args.xStart + xCtrWidth > args.destArea.w)
+		xCtrWidth = args.destArea.w - args.xStart;
+	if (args.xStart < 0) {
+		xCtrStart = -args.xStart;
+		args.xStart = 0;
+	}
+	int destY = args.yStart, yCtr = 0, yCtrHeight = args.dstRect.height();
+	if (args.yStart < 0) {
+		yCtr = -args.yStart;
+		destY = 0;
+	}
+	if (args.yStart + yCtrHeight > args.destArea.h)
+		yCtrHeight = args.destArea.h - args.yStart;
+	if (xCtrWidth <= xCtrStart)
+		return;
+
+	const int bpp = format.bytesPerPixel;
+	const uint rowSize = (xCtrWidth - xCtrStart) * bpp;
+	byte *destP = (byte *)args.destArea.getBasePtr(args.xStart, destY);
+	const byte *srcP = (const byte *)args.src.getBasePtr(args.srcArea.left + xCtrStart, args.srcArea.top + yCtr);
+	for (; yCtr < yCtrHeight; ++yCtr) {
+		// Source and destination may be the same bitmap
+		memmove(destP, srcP, rowSize);
+		destP += args.destArea.pitch;
+		srcP += args.src.pitch;
+	}
+}
 void BITMAP::blendPixel(uint8 aSrc, uint8 rSrc, uint8 gSrc, uint8 bSrc, uint8 &aDest, uint8 &rDest, uint8 &gDest, uint8 &bDest, uint32 alpha, bool useTint, byte *destVal) const {
 	switch (_G(_blender_mode)) {
 	case kSourceAlphaBlender:
@@ -308,6 +308,9 @@ public:
 #endif
 	template<int DestBytesPerPixel, int SrcBytesPerPixel, bool Scale>
 	void drawInnerGeneric(DrawInnerArgs &args);
+	// Plain row copy for unscaled, unflipped, opaque blits between
+	// surfaces of the same format
+	void drawInnerCopy(DrawInnerArgs &args);
 	
 	inline uint32 getColor(const byte *data, byte bpp) const {
 		switch (bpp) {
@@ -137,12 +137,16 @@ CastMember *Cast::getCastMember(int castId, bool load) {
 		// Archives only support having one stream open at a time,
 		// prevent recursive calls to CastMember::load()
 		_loadMutex = false;
+		bool wasLoaded = result->isLoaded();
 		result->load();
 		while (!_loadQueue.empty()) {
 			_loadQueue.back()->load();
 			_loadQueue.pop_back();
 		}
 		_loadMutex = true;
+
+		if (!wasLoaded)
+			g_director->touchCastMember(result);
 	} else if (result) {
 		_loadQueue.push_back(result);
 	}
@@ -564,6 +568,9 @@ bool Cast::loadConfig() {
 
 void Cast::loadCast() {
 	Common::SeekableReadStreamEndian *r = nullptr;
+	uint32 loadStart = g_system->getMillis(true);
+	uint32 compileTimeStart = _lingoArchive->compileTime;
+	uint32 compileCountStart = _lingoArchive->compileCount;
 
 	// Font Directory
 	_vm->_wm->_fontMan->loadFonts(_castArchive->getPathName());
@@ -750,6 +757,8 @@ void Cast::loadCast() {
 		debugC(4, kDebugLoading, "'SCRF' resource skipped");
 	}
 
+	debugC(1, kDebugLoading, "****** Loaded cast libID %d (%s) in %d ms, compiled %d scripts in %d ms", _castLibID, _castName.c_str(),
+		g_system->getMillis(true) - loadStart, _lingoArchive->compileCount - compileCountStart, _lingoArchive->compileTime - compileTimeStart);
 }
 
 Common::String Cast::getLinkedPath(int castId) {
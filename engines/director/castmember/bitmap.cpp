@@ -233,6 +233,11 @@ BitmapCastMember::~BitmapCastMember() {
 }
 
 Graphics::MacWidget *BitmapCastMember::createWidget(Common::Rect &bbox, Channel *channel, SpriteType spriteType) {
+	// The bitmap may have been purged to save memory
+	if (!_loaded)
+		load();
+	g_director->touchCastMember(this);
+
 	if (!_picture) {
 		warning("BitmapCastMember::createWidget: No picture");
 		return nullptr;
@@ -523,6 +528,9 @@ void BitmapCastMember::createMatte(const Common::Rect &bbox) {
 }
 
 Graphics::Surface *BitmapCastMember::getMatte(const Common::Rect &bbox) {
+	if (!_loaded)
+		load();
+
 	// Lazy loading of mattes
 	if (!_matte && !_noMatte) {
 		createMatte(bbox);
@@ -712,12 +720,24 @@ void BitmapCastMember::unload() {
 	delete _picture;
 	_picture = new Picture();
 
-	delete _ditheredImg;
-	_ditheredImg = nullptr;
+	if (_ditheredImg) {
+		_ditheredImg->free();
+		delete _ditheredImg;
+		_ditheredImg = nullptr;
+	}
 
 	_loaded = false;
 }
 
+uint32 BitmapCastMember::getLoadedSize() {
+	uint32 size = 0;
+	if (_picture)
+		size += _picture->_surface.pitch * _picture->_surface.h + _picture->getPaletteSize();
+	if (_ditheredImg)
+		size += _ditheredImg->pitch * _ditheredImg->h;
+	return size;
+}
+
 PictureReference *BitmapCastMember::getPicture() const {
 	auto picture = new PictureReference;
 
@@ -732,6 +752,8 @@ PictureReference *BitmapCastMember::getPicture() const {
 void BitmapCastMember::setPicture(PictureReference &picture) {
 	delete _picture;
 	_picture = new Picture(*picture._picture);
+	// The archive no longer has this picture, so it must stay loaded
+	_reloadable = false;
 
 	// Force redither
 	delete _ditheredImg;
@@ -52,6 +52,7 @@ public:
 
 	void load() override;
 	void unload() override;
+	uint32 getLoadedSize() override;
 
 	PictureReference *getPicture() const;
 	void setPicture(PictureReference &picture);
@@ -40,6 +40,7 @@ CastMember::CastMember(Cast *cast, uint16 castId, Common::SeekableReadStreamEndi
 	_modified = true;
 	_isChanged = false;
 	_needsReload = false;
+	_reloadable = true;
 
 	_objType = kCastMemberObj;
 
@@ -59,6 +60,8 @@ CastMember::CastMember(Cast *cast, uint16 castId) : Object<CastMember>("CastMemb
 	_loaded = false;
 	_modified = true;
 	_isChanged = false;
+	_needsReload = false;
+	_reloadable = false;
 
 	_objType = kCastMemberObj;
 
@@ -66,6 +69,11 @@ CastMember::CastMember(Cast *cast, uint16 castId) : Object<CastMember>("CastMemb
 	_erase = false;
 }
 
+CastMember::~CastMember() {
+	if (_loaded && g_director)
+		g_director->forgetCastMember(this);
+}
+
 void CastMember::setModified(bool modified) {
 	_modified = modified;
 	if (modified)
@@ -48,7 +48,7 @@ class CastMember : public Object<CastMember> {
 public:
 	CastMember(Cast *cast, uint16 castId, Common::SeekableReadStreamEndian &stream);
 	CastMember(Cast *cast, uint16 castId);
-	virtual ~CastMember() {}
+	virtual ~CastMember();
 
 	Cast *getCast() { return _cast; }
 	uint16 getID() { return _castId; }
@@ -57,6 +57,10 @@ public:
 	virtual void load();
 	virtual void unload();
 	bool isLoaded() { return _loaded; }
+	// Memory held by the data load() brings in
+	virtual uint32 getLoadedSize() { return 0; }
+	// Whether unload() may free the loaded data, to be reloaded on next use
+	bool isPurgeable() { return _loaded && _reloadable && _purgePriority != 0 && getLoadedSize() > 0; }
 
 	virtual bool isEditable() { return false; }
 	virtual void setEditable(bool editable) {}
@@ -118,6 +122,8 @@ protected:
 	bool _modified;
 	bool _isChanged;
 	bool _needsReload;
+	// load() can rebuild the data from the movie; false once it is replaced at runtime
+	bool _reloadable;
 };
 
 struct EditInfo {
@@ -138,14 +138,18 @@ void SoundCastMember::unload() {
 	if (!_loaded)
 		return;
 
+	// _size and _looping are member properties, kept for when the
+	// data is loaded again
 	delete _audio;
 	_audio = nullptr;
-	_size = 0;
-	_looping = false;
 
 	_loaded = false;
 }
 
+uint32 SoundCastMember::getLoadedSize() {
+	return _audio ? _size : 0;
+}
+
 bool SoundCastMember::hasField(int field) {
 	switch (field) {
 	case kTheChannelCount:
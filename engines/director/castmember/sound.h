@@ -36,6 +36,7 @@ public:
 
 	void load() override;
 	void unload() override;
+	uint32 getLoadedSize() override;
 	Common::String formatInfo() override;
 
 	bool hasField(int field) override;
@@ -33,11 +33,14 @@
 #include "director/debugger.h"
 #include "director/archive.h"
 #include "director/cast.h"
+#include "director/channel.h"
 #include "director/movie.h"
 #include "director/picture.h"
 #include "director/score.h"
 #include "director/sound.h"
+#include "director/sprite.h"
 #include "director/window.h"
+#include "director/castmember/castmember.h"
 #include "director/debugger/debugtools.h"
 
 /**
@@ -462,6 +465,59 @@ Common::Path DirectorEngine::getStartupPath() const {
 	return Common::Path(_options.startupPath, g_director->_dirSeparator);
 }
 
+void DirectorEngine::touchCastMember(CastMember *member) {
+	if (!member->isPurgeable())
+		return;
+
+	_loadedCastMembers.remove(member);
+	_loadedCastMembers.push_back(member);
+
+	uint32 total = 0;
+	for (auto &it : _loadedCastMembers)
+		total += it->getLoadedSize();
+
+	if (total <= kCastMemoryLimit)
+		return;
+
+	Score *score = (_currentWindow && getCurrentMovie()) ? getCurrentMovie()->getScore() : nullptr;
+
+	// Like Director, purge "purge next" members first and "purge last"
+	// ones only if that is not enough. Never purge what is on stage.
+	static const int purgeOrder[] = { 2, 3, 1 };
+
+	for (int i = 0; i < ARRAYSIZE(purgeOrder) && total > kCastMemoryLimit; i++) {
+		for (auto it = _loadedCastMembers.begin(); it != _loadedCastMembers.end() && total > kCastMemoryLimit;) {
+			CastMember *candidate = *it;
+			bool inUse = (candidate == member);
+
+			if (score) {
+				for (auto &channel : score->_channels) {
+					if (channel->_sprite->_cast == candidate) {
+						inUse = true;
+						break;
+					}
+				}
+			}
+
+			if (inUse || candidate->_purgePriority != purgeOrder[i] || !candidate->isPurgeable()) {
+				++it;
+				continue;
+			}
+
+			uint32 size = candidate->getLoadedSize();
+			debugC(2, kDebugLoading, "DirectorEngine::touchCastMember(): Purging cast member %d, %d bytes", candidate->getID(), size);
+
+			total -= size;
+			candidate->unload();
+			it = _loadedCastMembers.erase(it);
+		}
+	}
+}
+
+void DirectorEngine::forgetCastMember(CastMember *member) {
+	_loadedCastMembers.remove(member);
+}
+
 bool DirectorEngine::desktopEnabled() {
 	return !(_wmMode & Graphics::kWMModeNoDesktop);
 }
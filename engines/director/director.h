@@ -190,6 +190,8 @@ public:
 	Common::String getCurrentPath() const;
 	Common::String getCurrentAbsolutePath();
 	Common::Path getStartupPath() const;
+	void touchCastMember(CastMember *member);
+	void forgetCastMember(CastMember *member);
 
 	// graphics.cpp
 	bool hasFeature(EngineFeature f) const override;
@@ -327,6 +329,9 @@ private:
 	Graphics::ManagedSurface *_surface;
 	Graphics::Primitives *_primitives;
 
+	// Purgeable cast members with their data loaded, least recently used first
+	Common::List<CastMember *> _loadedCastMembers;
+
 	StartOptions _options;
 
 public:
@@ -700,6 +700,149 @@ void DirectorPlotData::inkBlitShape(Common::Rect &srcRect) {
 	}
 }
 
+// Row blitters for the most common surface inks. The generic path goes
+// through InkPrimitives::drawPoint() for every pixel, which looks at the
+// ink, the colour depth and the mask each time; here all of that is
+// resolved once per draw.
+
+template <typename T>
+struct InkOpCopy {
+	inline T operator()(T src, T dst) const { return src; }
+};
+
+template <typename T>
+struct InkOpBackgndTrans {
+	T backColor;
+	InkOpBackgndTrans(uint32 b) : backColor(b) {}
+	inline T operator()(T src, T dst) const { return (src == backColor) ? dst : src; }
+};
+
+template <typename T>
+struct InkOpOneBitBackgndTrans {
+	T colorBlack;
+	T foreColor;
+	InkOpOneBitBackgndTrans(uint32 b, uint32 f) : colorBlack(b), foreColor(f) {}
+	inline T operator()(T src, T dst) const { return (src == colorBlack) ? foreColor : dst; }
+};
+
+struct InkOpDark {
+	const Graphics::PixelFormat &fmt;
+	InkOpDark(const Graphics::PixelFormat &f) : fmt(f) {}
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		byte rSrc, gSrc, bSrc, rDst, gDst, bDst;
+		fmt.colorToRGB(src, rSrc, gSrc, bSrc);
+		fmt.colorToRGB(dst, rDst, gDst, bDst);
+		return fmt.RGBToColor(MIN(rSrc, rDst), MIN(gSrc, gDst), MIN(bSrc, bDst));
+	}
+};
+
+struct InkOpLight {
+	const Graphics::PixelFormat &fmt;
+	InkOpLight(const Graphics::PixelFormat &f) : fmt(f) {}
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		byte rSrc, gSrc, bSrc, rDst, gDst, bDst;
+		fmt.colorToRGB(src, rSrc, gSrc, bSrc);
+		fmt.colorToRGB(dst, rDst, gDst, bDst);
+		return fmt.RGBToColor(MAX(rSrc, rDst), MAX(gSrc, gDst), MAX(bSrc, bDst));
+	}
+};
+
+struct InkOpBlend {
+	const Graphics::PixelFormat &fmt;
+	int alpha;
+	InkOpBlend(const Graphics::PixelFormat &f, int a) : fmt(f), alpha(a) {}
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		byte rSrc, gSrc, bSrc, rDst, gDst, bDst;
+		fmt.colorToRGB(src, rSrc, gSrc, bSrc);
+		fmt.colorToRGB(dst, rDst, gDst, bDst);
+		return fmt.RGBToColor(lerpByte(rSrc, rDst, alpha, 255), lerpByte(gSrc, gDst, alpha, 255), lerpByte(bSrc, bDst, alpha, 255));
+	}
+};
+
+template <typename T, typename Op, bool hasMask>
+static void inkBlitRows(const Op &op, DirectorPlotData *p, const Common::Point &srcPos, const Graphics::Surface *mask) {
+	const Common::Rect &destRect = p->destRect;
+
+	for (int i = 0; i < destRect.height(); i++) {
+		T *dst = (T *)p->dst->getBasePtr(destRect.left, destRect.top + i);
+		const T *src = (const T *)p->srf->getBasePtr(srcPos.x, srcPos.y + i);
+		const byte *msk = hasMask ? (const byte *)mask->getBasePtr(srcPos.x, srcPos.y + i) : nullptr;
+
+		for (int j = 0; j < destRect.width(); j++) {
+			if (!hasMask || msk[j])
+				dst[j] = op(src[j], dst[j]);
+		}
+	}
+}
+
+template <typename T, typename Op>
+static void inkBlitRows(const Op &op, DirectorPlotData *p, const Common::Point &srcPos, const Graphics::Surface *mask) {
+	if (mask)
+		inkBlitRows<T, Op, true>(op, p, srcPos, mask);
+	else
+		inkBlitRows<T, Op, false>(op, p, srcPos, mask);
+}
+
+// Returns false if there is no specialised blitter for this draw, in
+// which case the caller falls back to per-pixel drawing.
+static bool inkBlitSurfaceRows(DirectorPlotData *p, const Common::Point &srcPos, const Graphics::Surface *mask) {
+	if (p->ms || p->applyColor)
+		return false;
+
+	// preprocessColor() rewrites the source colours for these
+	if (p->sprite == kTextSprite && p->ink == kInkTypeMask)
+		return false;
+
+	const Graphics::PixelFormat &fmt = p->d->_wm->_pixelformat;
+	bool trueColor = fmt.bytesPerPixel == 4;
+
+	// Arithmetic on paletted pixels needs a palette lookup per pixel,
+	// so only the true colour variants are worth specialising.
+	if (p->alpha) {
+		if (!trueColor)
+			return false;
+		inkBlitRows<uint32>(InkOpBlend(fmt, p->alpha), p, srcPos, mask);
+		return true;
+	}
+
+	switch (p->ink) {
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeBlend:
+	case kInkTypeCopy:
+		if (trueColor)
+			inkBlitRows<uint32>(InkOpCopy<uint32>(), p, srcPos, mask);
+		else
+			inkBlitRows<byte>(InkOpCopy<byte>(), p, srcPos, mask);
+		return true;
+	case kInkTypeBackgndTrans:
+		if (p->oneBitImage) {
+			if (trueColor)
+				inkBlitRows<uint32>(InkOpOneBitBackgndTrans<uint32>(p->colorBlack, p->foreColor), p, srcPos, mask);
+			else
+				inkBlitRows<byte>(InkOpOneBitBackgndTrans<byte>(p->colorBlack, p->foreColor), p, srcPos, mask);
+		} else {
+			if (trueColor)
+				inkBlitRows<uint32>(InkOpBackgndTrans<uint32>(p->backColor), p, srcPos, mask);
+			else
+				inkBlitRows<byte>(InkOpBackgndTrans<byte>(p->backColor), p, srcPos, mask);
+		}
+		return true;
+	case kInkTypeDark:
+		if (!trueColor)
+			return false;
+		inkBlitRows<uint32>(InkOpDark(fmt), p, srcPos, mask);
+		return true;
+	case kInkTypeLight:
+		if (!trueColor)
+			return false;
+		inkBlitRows<uint32>(InkOpLight(fmt), p, srcPos, mask);
+		return true;
+	default:
+		return false;
+	}
+}
+
 void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!srf)
 		return;
@@ -734,6 +877,12 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 	// format as the window manager. Most of the time this is
 	// the job of BitmapCastMember::createWidget.
 
+	Common::Point srcPos(abs(srcRect.left - destRect.left), abs(srcRect.top - destRect.top));
+	Common::Rect srcArea(srcPos.x, srcPos.y, srcPos.x + destRect.width(), srcPos.y + destRect.height());
+
+	if (srfClip.contains(srcArea) && inkBlitSurfaceRows(this, srcPos, mask))
+		return;
+
 	Graphics::Primitives *primitives = g_director->getInkPrimitives();
 
 	srcPoint.y = abs(srcRect.top - destRect.top);
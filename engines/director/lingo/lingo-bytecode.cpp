@@ -1701,7 +1701,10 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 }
 
 void LingoArchive::addCodeV4(Common::SeekableReadStreamEndian &stream, uint16 lctxIndex, const Common::String &archName, uint16 version) {
+	uint32 start = g_system->getMillis(true);
 	ScriptContext *ctx = g_lingo->_compiler->compileLingoV4(stream, lctxIndex, this, archName, version);
+	compileTime += g_system->getMillis(true) - start;
+	compileCount++;
 	if (ctx) {
 		lctxContexts[lctxIndex] = ctx;
 		ctx->incRefCount();
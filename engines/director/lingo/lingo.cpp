@@ -358,7 +358,10 @@ void LingoArchive::patchCode(const Common::U32String &code, ScriptType type, uin
 		return;
 	}
 
+	uint32 start = g_system->getMillis(true);
 	ScriptContext *sc = g_lingo->_compiler->compileLingo(code, nullptr, type, CastMemberID(id, cast->_castLibID), scriptName, false, preprocFlags);
+	compileTime += g_system->getMillis(true) - start;
+	compileCount++;
 
 	if (sc) {
 		for (auto &it : sc->_functionHandlers) {
@@ -393,7 +396,10 @@ void LingoArchive::addCode(const Common::U32String &code, ScriptType type, uint1
 	else
 		contextName = Common::String::format("%d", id);
 
+	uint32 start = g_system->getMillis(true);
 	ScriptContext *sc = g_lingo->_compiler->compileLingo(code, this, type, CastMemberID(id, cast->_castLibID), contextName, false, preprocFlags);
+	compileTime += g_system->getMillis(true) - start;
+	compileCount++;
 	if (sc) {
 		scriptContexts[type][id] = sc;
 		sc->incRefCount();
@@ -868,29 +874,82 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool equality) {
 	return opType;
 }
 
+// Types whose value lives entirely in the union and needs no refCount
+static bool isScalarType(DatumType type) {
+	switch (type) {
+	case VOID:
+	case INT:
+	case FLOAT:
+	case ARGC:
+	case ARGCNORET:
+	case CASTLIBREF:
+	case SPRITEREF:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Returns the refCount to share with a new copy of d, creating it if needed
+static int *shareRefCount(const Datum &d) {
+	if (!d.refCount && !isScalarType(d.type)) {
+		d.refCount = new int;
+		*d.refCount = 1;
+	}
+	return d.refCount;
+}
+
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Datum &d) {
+	type = d.type;
+	u = d.u;
+	refCount = shareRefCount(d);
+	if (refCount)
+		*refCount += 1;
+	ignoreGlobal = false;
+}
+
+Datum::Datum(Datum &&d) {
 	type = d.type;
 	u = d.u;
 	refCount = d.refCount;
-	*refCount += 1;
 	ignoreGlobal = false;
+
+	d.type = VOID;
+	d.u.s = nullptr;
+	d.refCount = nullptr;
 }
 
 Datum& Datum::operator=(const Datum &d) {
-	if (this != &d && refCount != d.refCount) {
+	if (this != &d && (!refCount || refCount != d.refCount)) {
+		int *newRefCount = shareRefCount(d);
+		reset();
+		type = d.type;
+		u = d.u;
+		refCount = newRefCount;
+		if (refCount)
+			*refCount += 1;
+	}
+	ignoreGlobal = false;
+	return *this;
+}
+
+Datum& Datum::operator=(Datum &&d) {
+	if (this != &d) {
 		reset();
 		type = d.type;
 		u = d.u;
 		refCount = d.refCount;
-		*refCount += 1;
+
+		d.type = VOID;
+		d.u.s = nullptr;
+		d.refCount = nullptr;
 	}
 	ignoreGlobal = false;
 	return *this;
@@ -899,24 +958,21 @@ Datum& Datum::operator=(const Datum &d) {
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Common::String &val) {
 	u.s = new Common::String(val);
 	type = STRING;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
@@ -928,8 +984,7 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 	ignoreGlobal = false;
 }
@@ -937,8 +992,7 @@ Datum::Datum(AbstractObject *val) {
 Datum::Datum(const CastMemberID &val) {
 	u.cast = new CastMemberID(val);
 	type = CASTREF;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
@@ -947,8 +1001,7 @@ Datum::Datum(const Common::Point &point) {
 	u.farr = new FArray;
 	u.farr->arr.push_back(Datum(point.x));
 	u.farr->arr.push_back(Datum(point.y));
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
@@ -959,77 +1012,78 @@ Datum::Datum(const Common::Rect &rect) {
 	u.farr->arr.push_back(Datum(rect.top));
 	u.farr->arr.push_back(Datum(rect.right));
 	u.farr->arr.push_back(Datum(rect.bottom));
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 void Datum::reset() {
-	if (!refCount)
-		return;
+	// Without a refCount this Datum is the only owner of its value
+	if (refCount) {
+		*refCount -= 1;
+		if (*refCount > 0)
+			return;
+	}
 
-	*refCount -= 1;
 	// Coverity thinks that we always free memory, as it assumes
 	// (correctly) that there are cases when refCount == 0
 	// Thus, DO NOT COMPILE, trick it and shut tons of false positives
 #ifndef __COVERITY__
-	if (*refCount <= 0) {
-		switch (type) {
-		case VOID:
-		case INT:
-		case FLOAT:
-		case ARGC:
-		case ARGCNORET:
-		case CASTLIBREF:
-		case SPRITEREF:
-			break;
-		case VARREF:
-		case GLOBALREF:
-		case LOCALREF:
-		case PROPREF:
-		case STRING:
-		case SYMBOL:
-			delete u.s;
-			break;
-		case ARRAY:
-		case POINT:
-		case RECT:
-			delete u.farr;
-			break;
-		case PARRAY:
-			delete u.parr;
-			break;
-		case OBJECT:
-			if (u.obj->getObjType() == kWindowObj) {
-				// Window has an override for decRefCount, use it directly
+	switch (type) {
+	case VOID:
+	case INT:
+	case FLOAT:
+	case ARGC:
+	case ARGCNORET:
+	case CASTLIBREF:
+	case SPRITEREF:
+		break;
+	case VARREF:
+	case GLOBALREF:
+	case LOCALREF:
+	case PROPREF:
+	case STRING:
+	case SYMBOL:
+		delete u.s;
+		break;
+	case ARRAY:
+	case POINT:
+	case RECT:
+		delete u.farr;
+		break;
+	case PARRAY:
+		delete u.parr;
+		break;
+	case OBJECT:
+		if (u.obj->getObjType() == kWindowObj) {
+			// Window has an override for decRefCount, use it directly
+			if (refCount)
 				*refCount += 1;
-				static_cast<Window *>(u.obj)->decRefCount();
-			} else {
-				// *refCount is copied between the Datum and the Object,
-				// so should be safe to delete the Object
-				delete u.obj;
-			}
-			break;
-		case CHUNKREF:
-			delete u.cref;
-			break;
-		case CASTREF:
-		case FIELDREF:
-			delete u.cast;
-			break;
-		case MENUREF:
-			delete u.menu;
-			break;
-		case PICTUREREF:
-			delete u.picture;
-			break;
-		default:
-			warning("Datum::reset(): Unprocessed REF type %d", type);
-			break;
+			static_cast<Window *>(u.obj)->decRefCount();
+		} else {
+			// *refCount is copied between the Datum and the Object,
+			// so should be safe to delete the Object
+			delete u.obj;
 		}
-		if (type != OBJECT) // object owns refCount
-			delete refCount;
+		break;
+	case CHUNKREF:
+		delete u.cref;
+		break;
+	case CASTREF:
+	case FIELDREF:
+		delete u.cast;
+		break;
+	case MENUREF:
+		delete u.menu;
+		break;
+	case PICTUREREF:
+		delete u.picture;
+		break;
+	default:
+		warning("Datum::reset(): Unprocessed REF type %d", type);
+		break;
 	}
+	if (type != OBJECT) // object owns refCount
+		delete refCount;
 #endif
 }
 
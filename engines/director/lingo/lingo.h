@@ -143,13 +143,18 @@ struct Datum {	/* interpreter stack type */
 		PictureReference *picture; /* PICTUREREF */
 	} u;
 
-	int *refCount;
+	// Shared by all copies of a heap value. Allocated lazily on the first
+	// copy, so scalars and values that are never copied go without;
+	// nullptr means this Datum is the only owner.
+	mutable int *refCount;
 
 	bool ignoreGlobal; // True if this Datum should be ignored by showGlobals and clearGlobals
 
 	Datum();
 	Datum(const Datum &d);
+	Datum(Datum &&d);
 	Datum& operator=(const Datum &d);
+	Datum& operator=(Datum &&d);
 	Datum(int val);
 	Datum(double val);
 	Datum(const Common::String &val);
@@ -307,6 +312,10 @@ struct LingoArchive {
 	Common::HashMap<uint32, Common::String> primaryEventHandlers;
 	SymbolHash functionHandlers;
 
+	// Time spent compiling scripts for this archive, for load diagnostics
+	uint32 compileTime = 0;
+	uint32 compileCount = 0;
+
 	ScriptContext *getScriptContext(ScriptType type, uint16 id);
 	ScriptContext *findScriptContext(uint16 id);
 	Common::String getName(uint16 id);
@@ -186,6 +186,8 @@ void DirectorSound::playCastMember(CastMemberID memberID, uint8 soundChannel, bo
 					stopOnZero = false;
 				}
 
+				g_director->touchCastMember(soundCast);
+
 				AudioDecoder *ad = ((SoundCastMember *)soundCast)->_audio;
 				if (!ad) {
 					warning("DirectorSound::playCastMember: no audio data attached to %s", memberID.asString().c_str());
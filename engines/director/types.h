@@ -30,6 +30,10 @@ enum {
 	kFewFamesMaxCounter = 19,
 };
 
+enum {
+	kCastMemoryLimit = 64 * 1024 * 1024	// Loaded bitmap and sound data kept before purging
+};
+
 enum {
 	kShotColorDiffThreshold = 2,
 	kShotPercentPixelThreshold = 1
@@ -47,6 +47,8 @@ Window::Window(int id, bool scrollable, bool resizable, bool editable, Graphics:
 	_vm = vm;
 	_isStage = isStage;
 	_stageColor = _wm->_colorBlack;
+	_clearedPixels = 0;
+	_blittedPixels = 0;
 	_puppetTransition = nullptr;
 	_soundManager = new DirectorSound(this);
 	_lingoState = new LingoState;
@@ -177,6 +179,10 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	uint32 renderStartTime = g_system->getMillis();
 	debugC(7, kDebugImages, "Window::render(): Updating %d rects", _dirtyRects.size());
 
+	// Per-frame cost of the recomposition, reported below
+	_clearedPixels = 0;
+	_blittedPixels = 0;
+
 	for (auto &i : _dirtyRects) {
 		Common::Rect r = i;
 		// The inner dimensions are relative to the virtual desktop while
@@ -200,6 +206,7 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 
 		if (shouldClear) {
 			blitTo->fillRect(r, _stageColor);
+			_clearedPixels += r.width() * r.height();
 		} else if (trailChannel) {
 			// Trail rendering mode; do not re-render the background and sprites underneath.
 			_dirtyChannels.clear();
@@ -258,7 +265,8 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 
 	_dirtyRects.clear();
 	_contentIsDirty = true;
-	debugC(7, kDebugImages, "Window::render(): Draw finished in %d ms",  g_system->getMillis() - renderStartTime);
+	debugC(7, kDebugImages, "Window::render(): Draw finished in %d ms, %d pixels cleared, %d pixels blitted",
+			g_system->getMillis() - renderStartTime, _clearedPixels, _blittedPixels);
 
 	return true;
 }
@@ -346,8 +354,10 @@ void Window::inkBlitFrom(Channel *channel, Common::Rect destRect, Graphics::Mana
 
 	if (pd.ms) {
 		pd.inkBlitShape(srcRect);
+		_blittedPixels += destRect.width() * destRect.height();
 	} else if (pd.srf) {
 		pd.inkBlitSurface(srcRect, channel->getMask());
+		_blittedPixels += destRect.width() * destRect.height();
 	} else {
 		if (debugChannelSet(4, kDebugImages)) {
 			CastType castType = channel->_sprite->_cast ? channel->_sprite->_cast->_type : kCastTypeNull;
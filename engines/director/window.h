@@ -208,6 +208,8 @@ public:
 
 private:
 	uint32 _stageColor;
+	uint32 _clearedPixels;
+	uint32 _blittedPixels;
 
 	DirectorEngine *_vm;
 	DirectorSound *_soundManager;
@@ -107,6 +107,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 
 Myst3Engine::~Myst3Engine() {
 	closeArchives();
+	clearCubeFaceCache();
 
 	delete _menu;
 	delete _inventory;
@@ -1459,6 +1460,54 @@ Graphics::Surface *Myst3Engine::decodeJpeg(const ResourceDescription *jpegDesc)
 	return rgbaSurface;
 }
 
+Graphics::Surface *Myst3Engine::decodeCubeFace(uint16 index, uint16 face) {
+	Common::String room = _db->getRoomName(_state->getLocationRoom(), _state->getLocationAge());
+	Common::String key = Common::String::format("%s-%d-%d", room.c_str(), index, face);
+
+	Graphics::Surface *bitmap = nullptr;
+	for (Common::List<CachedCubeFace>::iterator it = _cubeFaceCache.begin(); it != _cubeFaceCache.end(); it++) {
+		if (it->key == key) {
+			bitmap = it->bitmap;
+			_cubeFaceCache.erase(it);
+			break;
+		}
+	}
+
+	if (!bitmap) {
+		ResourceDescription jpegDesc = getFileDescription(room, index, face, Archive::kCubeFace);
+		if (!jpegDesc.isValid())
+			error("Face %d does not exist", index);
+
+		bitmap = decodeJpeg(&jpegDesc);
+	} else {
+		debugC(kDebugNode, "Reusing decoded face %d of node %s %d", face, room.c_str(), index);
+	}
+
+	CachedCubeFace cached;
+	cached.key = key;
+	cached.bitmap = bitmap;
+	_cubeFaceCache.push_front(cached);
+
+	while (_cubeFaceCache.size() > kCubeFaceCacheSize) {
+		_cubeFaceCache.back().bitmap->free();
+		delete _cubeFaceCache.back().bitmap;
+		_cubeFaceCache.pop_back();
+	}
+
+	// The node draws its spot items on the face, so it gets its own copy
+	Graphics::Surface *copy = new Graphics::Surface();
+	copy->copyFrom(*bitmap);
+	return copy;
+}
+
+void Myst3Engine::clearCubeFaceCache() {
+	for (Common::List<CachedCubeFace>::iterator it = _cubeFaceCache.begin(); it != _cubeFaceCache.end(); it++) {
+		it->bitmap->free();
+		delete it->bitmap;
+	}
+	_cubeFaceCache.clear();
+}
+
 int16 Myst3Engine::openDialog(uint16 id) {
 	Dialog *dialog;
 
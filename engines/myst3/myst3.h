@@ -25,6 +25,7 @@
 #include "engines/engine.h"
 
 #include "common/array.h"
+#include "common/list.h"
 #include "common/ptr.h"
 #include "common/system.h"
 #include "common/random.h"
@@ -133,6 +134,7 @@ public:
 
 	Graphics::Surface *loadTexture(uint16 id);
 	static Graphics::Surface *decodeJpeg(const ResourceDescription *jpegDesc);
+	Graphics::Surface *decodeCubeFace(uint16 index, uint16 face);
 
 	void goToNode(uint16 nodeID, TransitionType transition);
 	void loadNode(uint16 nodeID, uint32 roomID = 0, uint32 ageID = 0);
@@ -199,6 +201,19 @@ private:
 	Common::Array<Archive *> _archivesCommon;
 	Archive *_archiveNode;
 
+	struct CachedCubeFace {
+		Common::String key;
+		Graphics::Surface *bitmap;
+	};
+
+	/**
+	 * Recently decoded cube faces, most recently used first.
+	 * Going back to a node that was just visited does not need
+	 * to decode its JPEG faces again.
+	 */
+	Common::List<CachedCubeFace> _cubeFaceCache;
+	static const uint kCubeFaceCacheSize = 24;
+
 	Script *_scriptEngine;
 
 	Common::Array<ScriptedMovie *> _movies;
@@ -242,6 +257,7 @@ private:
 	bool addArchive(const Common::String &file, bool mandatory);
 	void openArchives();
 	void closeArchives();
+	void clearCubeFaceCache();
 
 	bool isInventoryVisible();
 
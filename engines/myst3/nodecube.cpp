@@ -32,13 +32,8 @@ NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 	_is3D = true;
 
 	for (int i = 0; i < 6; i++) {
-		ResourceDescription jpegDesc = _vm->getFileDescription("", id, i + 1, Archive::kCubeFace);
-
-		if (!jpegDesc.isValid())
-			error("Face %d does not exist", id);
-
 		_faces[i] = new Face(_vm, true);
-		_faces[i]->setTextureFromJPEG(&jpegDesc);
+		_faces[i]->setTextureFromBitmap(_vm->decodeCubeFace(id, i + 1));
 	}
 }
 
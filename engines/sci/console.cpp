@@ -117,6 +117,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("resource_types",		WRAP_METHOD(Console, cmdResourceTypes));
 	registerCmd("list",				WRAP_METHOD(Console, cmdList));
 	registerCmd("alloc_list",				WRAP_METHOD(Console, cmdAllocList));
+	registerCmd("resource_stats",		WRAP_METHOD(Console, cmdResourceStats));
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	registerCmd("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
 	registerCmd("integrity_dump",	WRAP_METHOD(Console, cmdResourceIntegrityDump));
@@ -163,6 +164,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -233,6 +235,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("bpe",				WRAP_METHOD(Console, cmdBreakpointFunction));		// alias
 	// VM
 	registerCmd("script_steps",		WRAP_METHOD(Console, cmdScriptSteps));
+	registerCmd("vm_stats",			WRAP_METHOD(Console, cmdVMStats));
 	registerCmd("script_objects",   WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("scro",             WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("script_strings",   WRAP_METHOD(Console, cmdScriptStrings));
@@ -357,6 +360,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" resource_types - Shows the valid resource types\n");
 	debugPrintf(" list - Lists all the resources of a given type\n");
 	debugPrintf(" alloc_list - Lists all allocated resources\n");
+	debugPrintf(" resource_stats - Shows resource cache statistics\n");
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	debugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
 	debugPrintf(" integrity_dump - Dumps integrity data about resources in the current game to disk\n");
@@ -398,6 +402,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows heap and garbage collection statistics\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -447,6 +452,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf("\n");
 	debugPrintf("VM:\n");
 	debugPrintf(" script_steps - Shows the number of executed SCI operations\n");
+	debugPrintf(" vm_stats - Shows script interpreter statistics\n");
 	debugPrintf(" script_objects / scro - Shows all objects inside a specified script\n");
 	debugPrintf(" script_strings / scrs - Shows all strings inside a specified script\n");
 	debugPrintf(" script_said - Shows all said - strings inside a specified script\n");
@@ -1134,6 +1140,32 @@ bool Console::cmdAllocList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdResourceStats(int argc, const char **argv) {
+	ResourceManager *resMan = _engine->getResMan();
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		resMan->resetCacheStats();
+		debugPrintf("Resource cache statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows resource cache statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const ResourceCacheStats &stats = resMan->getCacheStats();
+	const uint32 lookups = stats.hits + stats.misses;
+
+	debugPrintf("Cache size: %d KiB (%d KiB used, %d KiB locked)\n",
+		resMan->getMaxMemoryLRU() / 1024, resMan->getMemoryLRU() / 1024, resMan->getMemoryLocked() / 1024);
+	debugPrintf("Lookups: %u (%u hits, %u misses, %u%% hit rate)\n",
+		lookups, stats.hits, stats.misses, lookups ? stats.hits * 100 / lookups : 0);
+	debugPrintf("Evictions: %u\n", stats.evictions);
+	debugPrintf("Bytes decompressed: %llu\n", (unsigned long long)stats.bytesDecompressed);
+
+	return true;
+}
+
 bool Console::cmdDissectScript(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Examines a script\n");
@@ -2904,6 +2936,56 @@ bool Console::cmdGCShowFreeable(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	GCStats &stats = _engine->_gcStats;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		stats.reset();
+		debugPrintf("Garbage collection statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows heap and garbage collection statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	static const char *const segmentTypeNames[SEG_TYPE_MAX] = {
+		"invalid", "script", "clones", "locals", "stack", "obsolete", "lists",
+		"nodes", "hunk", "dynmem",
+#ifdef ENABLE_SCI32
+		"obsolete", "arrays", "obsolete", "bitmaps"
+#endif
+	};
+	uint segments[SEG_TYPE_MAX] = {};
+	uint entries[SEG_TYPE_MAX] = {};
+
+	const Common::Array<SegmentObj *> &heap = _engine->_gamestate->_segMan->getSegments();
+	for (uint i = 1; i < heap.size(); i++) {
+		if (!heap[i])
+			continue;
+
+		const SegmentType type = heap[i]->getType();
+		segments[type]++;
+		if (type == SEG_TYPE_SCRIPT)
+			entries[type] += ((Script *)heap[i])->getObjectMap().size();
+		else
+			entries[type] += heap[i]->listAllDeallocatable(i).size();
+	}
+
+	debugPrintf("Heap:\n");
+	for (uint i = 1; i < SEG_TYPE_MAX; i++) {
+		if (segments[i])
+			debugPrintf(" %-8s %u segments, %u entries\n", segmentTypeNames[i], segments[i], entries[i]);
+	}
+
+	debugPrintf("Garbage collections: %u (every %d kernel calls)\n", stats.collections, _engine->_gamestate->scriptGCInterval);
+	debugPrintf("Objects freed: %u (%u by the last collection)\n", stats.freedObjects, stats.lastFreed);
+	debugPrintf("Reachable addresses at the last collection: %u\n", stats.lastReachable);
+	debugPrintf("Pause time: %u ms last, %u ms max, %u ms total\n", stats.lastPause, stats.maxPause, stats.totalPause);
+
+	return true;
+}
+
 bool Console::cmdGCNormalize(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Prints the \"normal\" address of a given address,\n");
@@ -3436,6 +3518,32 @@ bool Console::cmdScriptSteps(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdVMStats(int argc, const char **argv) {
+	VMStats &stats = _engine->_vmStats;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		stats.reset();
+		_engine->_gamestate->scriptStepCounter = 0;
+		debugPrintf("Script interpreter statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows script interpreter statistics. Resetting them, then playing\n");
+		debugPrintf("back an event recording gives a reproducible benchmark.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const int steps = _engine->_gamestate->scriptStepCounter;
+	debugPrintf("Executed instructions: %d\n", steps);
+	debugPrintf("Decoded instructions: %u\n", stats.decodedInstructions);
+	debugPrintf("Time spent in scripts: %u ms\n", stats.runTime);
+	if (stats.runTime)
+		debugPrintf("Instructions per second: %llu\n", (unsigned long long)((uint64)steps * 1000 / stats.runTime));
+	debugPrintf("Selector cache: %u hits, %u misses\n", stats.selectorCacheHits, stats.selectorCacheMisses);
+
+	return true;
+}
+
 bool Console::cmdScriptObjects(int argc, const char **argv) {
 	if (argc < 2) {
 		debugPrintf("Shows all objects inside a specified script.\n");
@@ -87,6 +87,50 @@ struct DebugState {
 	void updateActiveBreakpointTypes();
 };
 
+/**
+ * Interpreter counters, shown by the vm_stats debugger command along with
+ * EngineState::scriptStepCounter. Playing back an event recording and
+ * comparing these gives a reproducible benchmark of the script interpreter.
+ */
+struct VMStats {
+	uint32 decodedInstructions;  ///< Opcodes decoded into script instruction caches
+	uint32 runTime;              ///< Milliseconds spent in run_vm
+	uint32 selectorCacheHits;    ///< Selector lookups served from the selector cache
+	uint32 selectorCacheMisses;  ///< Selector lookups that walked the class hierarchy
+
+	VMStats() { reset(); }
+	void reset() {
+		decodedInstructions = 0;
+		runTime = 0;
+		selectorCacheHits = 0;
+		selectorCacheMisses = 0;
+	}
+};
+
+/**
+ * Garbage collector counters, shown by the gc_stats debugger command.
+ */
+struct GCStats {
+	uint32 collections;   ///< Number of garbage collections run
+	uint32 freedObjects;  ///< Objects freed by all collections
+	uint32 lastFreed;     ///< Objects freed by the last collection
+	uint32 lastReachable; ///< Reachable addresses found by the last collection
+	uint32 lastPause;     ///< Duration of the last collection, in milliseconds
+	uint32 maxPause;      ///< Duration of the longest collection, in milliseconds
+	uint32 totalPause;    ///< Duration of all collections, in milliseconds
+
+	GCStats() { reset(); }
+	void reset() {
+		collections = 0;
+		freedObjects = 0;
+		lastFreed = 0;
+		lastReachable = 0;
+		lastPause = 0;
+		maxPause = 0;
+		totalPause = 0;
+	}
+};
+
 // Various global variables used for debugging are declared here
 extern int g_debug_sleeptime_factor;
 extern int g_debug_simulated_key;
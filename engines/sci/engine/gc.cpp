@@ -21,6 +21,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -180,6 +181,9 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 void run_gc(EngineState *s) {
 	SegManager *segMan = s->_segMan;
+	GCStats &stats = g_sci->_gcStats;
+	const uint32 startTime = g_system->getMillis(true);
+	uint32 freed = 0;
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -192,6 +196,7 @@ void run_gc(EngineState *s) {
 
 	// Compute the set of all segments references currently in use.
 	AddrSet *activeRefs = findAllActiveReferences(s);
+	stats.lastReachable = activeRefs->size();
 
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
@@ -213,6 +218,7 @@ void run_gc(EngineState *s) {
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					freed++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -225,6 +231,15 @@ void run_gc(EngineState *s) {
 
 	delete activeRefs;
 
+	const uint32 pause = g_system->getMillis(true) - startTime;
+	stats.collections++;
+	stats.freedObjects += freed;
+	stats.lastFreed = freed;
+	stats.lastPause = pause;
+	stats.maxPause = MAX(stats.maxPause, pause);
+	stats.totalPause += pause;
+	debugC(kDebugLevelGC, "[GC] Freed %u objects in %u ms", freed, pause);
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -45,6 +45,10 @@ reg_t kLoad(EngineState *s, int argc, reg_t *argv) {
 	if (restype == kResourceTypeMemory)
 		return s->_segMan->allocateHunkEntry("kLoad()", resnr);
 
+	// SSCI loaded the resource here. We load resources lazily on first use
+	// instead, but let the volume file start reading it in the background.
+	g_sci->getResMan()->prefetchResource(ResourceId(restype, resnr));
+
 	return make_reg(0, ((restype << 11) | resnr)); // Return the resource identifier as handle
 }
 
@@ -74,6 +74,33 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
 	_offsetLookupSaidCount = 0;
+
+	invalidateInstructionCache();
+}
+
+void Script::invalidateInstructionCache() {
+	_instructionIndex.clear();
+	_instructions.clear();
+}
+
+const PMachineInstruction &Script::decodeInstruction(uint32 offset) {
+	if (_instructionIndex.empty())
+		_instructionIndex.resize(getBufSize());
+
+	PMachineInstruction instruction;
+	instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.opparams);
+
+	if (_instructions.size() == 0xFFFF) {
+		// The index is full, so stop caching. This should never happen,
+		// since scripts are far smaller than 64K instructions.
+		_uncachedInstruction = instruction;
+		return _uncachedInstruction;
+	}
+
+	_instructions.push_back(instruction);
+	_instructionIndex[offset] = _instructions.size();
+	g_sci->_vmStats.decodedInstructions++;
+	return _instructions.back();
 }
 
 enum {
@@ -93,6 +93,14 @@ private:
 
 	ObjMap _objects;	/**< Table for objects, contains property variables */
 
+	/**
+	 * Maps buffer offsets to 1-based indices into _instructions, or 0 if no
+	 * instruction has been decoded at that offset yet.
+	 */
+	Common::Array<uint16> _instructionIndex;
+	Common::Array<PMachineInstruction> _instructions; /**< Cache of decoded instructions */
+	PMachineInstruction _uncachedInstruction; /**< Returned when _instructions is full */
+
 protected:
 	offsetLookupArrayType _offsetLookupArray; // Table of all elements of currently loaded script, that may get pointed to
 
@@ -138,6 +146,24 @@ public:
 	void freeScript(const bool keepLocalsSegment = false);
 	void load(int script_nr, ResourceManager *resMan, ScriptPatcher *scriptPatcher, bool applyScriptPatches = true);
 
+	/**
+	 * Returns the decoded instruction at the given offset. Instructions are
+	 * decoded on first use and cached until the script is reloaded, or until
+	 * invalidateInstructionCache() is called.
+	 */
+	const PMachineInstruction &getInstruction(uint32 offset) {
+		const uint16 index = offset < _instructionIndex.size() ? _instructionIndex[offset] : 0;
+		if (index)
+			return _instructions[index - 1];
+		return decodeInstruction(offset);
+	}
+
+	/**
+	 * Drops all decoded instructions. This must be called whenever the
+	 * script code is modified after it has been loaded.
+	 */
+	void invalidateInstructionCache();
+
 	bool isValidOffset(uint32 offset) const override;
 	SegmentRef dereference(reg_t pointer) override;
 	reg_t findCanonicAddress(SegManager *segMan, reg_t sub_addr) const override;
@@ -300,6 +326,8 @@ public:
 	uint32 getRelocationOffset(const uint32 offset) const;
 
 private:
+	const PMachineInstruction &decodeInstruction(uint32 offset);
+
 	/**
 	 * Returns a Span containing the relocation table for a SCI0-SCI2.1 script.
 	 * (The SCI0-SCI2.1 relocation table is simply a list of all of the
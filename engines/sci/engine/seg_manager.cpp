@@ -48,6 +48,7 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 #endif
 
 	createClassTable();
+	flushSelectorCache();
 }
 
 SegManager::~SegManager() {
@@ -79,6 +80,12 @@ void SegManager::resetSegMan() {
 	// Reinitialize class table
 	_classTable.clear();
 	createClassTable();
+	flushSelectorCache();
+}
+
+void SegManager::flushSelectorCache() {
+	for (uint i = 0; i < kSelectorCacheSize; i++)
+		_selectorCache[i].selector = -1;
 }
 
 void SegManager::initSysStrings() {
@@ -165,6 +172,7 @@ void SegManager::deallocate(SegmentId seg) {
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
+		flushSelectorCache();
 		if (scr->getLocalsSegment()) {
 			// Check if the locals segment has already been deallocated.
 			// If the locals block has been stored in a segment with an ID
@@ -1102,6 +1110,7 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 	scr->load(scriptNum, _resMan, _scriptPatcher, applyScriptPatches);
 	scr->initializeLocals(this);
 	scr->initializeObjects(this, segmentId, applyScriptPatches);
+	flushSelectorCache();
 #ifdef ENABLE_SCI32
 	g_sci->_guestAdditions->instantiateScriptHook(*scr);
 #endif
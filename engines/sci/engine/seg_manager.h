@@ -45,6 +45,21 @@ enum ScriptLoadType {
 
 class Script;
 
+/**
+ * A cached result of lookupSelector().
+ */
+struct SelectorCacheEntry {
+	reg_t pos;          ///< Position of the object the lookup was done on
+	Selector selector;  ///< Selector that was looked up, or -1 if the entry is unused
+	SelectorType type;
+	int varIndex;       ///< Index of the property, for kSelectorVariable
+	reg_t func;         ///< Address of the method, for kSelectorMethod
+};
+
+enum {
+	kSelectorCacheSize = 1024 ///< Number of entries in the selector cache, must be a power of two
+};
+
 class SegManager : public Common::Serializable {
 	friend class Console;
 public:
@@ -460,6 +475,25 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	/**
+	 * Returns the selector cache slot for the object at the given position.
+	 * The caller must check whether the slot actually holds that lookup.
+	 *
+	 * Lookups are keyed by object position rather than address, since clones
+	 * share their position (and thus their methods, properties and
+	 * superclass) with the object they were cloned from.
+	 */
+	SelectorCacheEntry &getSelectorCacheEntry(reg_t pos, Selector selectorId) {
+		uint hash = (pos.getSegment() * 31 + pos.getOffset()) * 31 + selectorId;
+		return _selectorCache[hash & (kSelectorCacheSize - 1)];
+	}
+
+	/**
+	 * Invalidates all cached selector lookups. This is needed whenever
+	 * scripts are loaded or freed, as that changes the class hierarchy.
+	 */
+	void flushSelectorCache();
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
@@ -469,6 +503,8 @@ private:
 	ResourceManager *_resMan;
 	ScriptPatcher *_scriptPatcher;
 
+	SelectorCacheEntry _selectorCache[kSelectorCacheSize];
+
 	SegmentId _clonesSegId; ///< ID of the (a) clones segment
 	SegmentId _listsSegId; ///< ID of the (a) list segment
 	SegmentId _nodesSegId; ///< ID of the (a) node segment
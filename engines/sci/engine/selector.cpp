@@ -323,36 +323,23 @@ void invokeSelector(EngineState *s, reg_t object, int selectorId,
 	run_vm(s); // Start a new vm
 }
 
-SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
-	const Object *obj = segMan->getObject(obj_location);
-	bool oldScriptHeader = (getSciVersion() == SCI_VERSION_0_EARLY);
-
-	// Early SCI versions used the LSB in the selector ID as a read/write
-	// toggle, meaning that we must remove it for selector lookup.
-	if (oldScriptHeader)
-		selectorId &= ~1;
-
-	if (!obj) {
-		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x", PRINT_REG(obj_location));
-	}
-
+/**
+ * Looks up a selector on an object and its superclasses, without using the
+ * selector cache.
+ */
+static SelectorType findSelector(SegManager *segMan, const Object *obj, Selector selectorId, int &varIndex, reg_t &func) {
 	int index = obj->locateVarSelector(segMan, selectorId);
 
 	if (index >= 0) {
 		// Found it as a variable
-		if (varp) {
-			varp->obj = obj_location;
-			varp->varindex = index;
-		}
+		varIndex = index;
 		return kSelectorVariable;
 	} else {
 		// Check if it's a method, with recursive lookup in superclasses
 		while (obj) {
 			index = obj->funcSelectorPosition(selectorId);
 			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
+				func = obj->getFunction(index);
 				return kSelectorMethod;
 			} else {
 				obj = segMan->getObject(obj->getSuperClassSelector());
@@ -363,4 +350,37 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 	}
 }
 
+SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
+	const Object *obj = segMan->getObject(obj_location);
+	bool oldScriptHeader = (getSciVersion() == SCI_VERSION_0_EARLY);
+
+	// Early SCI versions used the LSB in the selector ID as a read/write
+	// toggle, meaning that we must remove it for selector lookup.
+	if (oldScriptHeader)
+		selectorId &= ~1;
+
+	if (!obj) {
+		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x", PRINT_REG(obj_location));
+	}
+
+	SelectorCacheEntry &entry = segMan->getSelectorCacheEntry(obj->getPos(), selectorId);
+	if (entry.selector == selectorId && entry.pos == obj->getPos()) {
+		g_sci->_vmStats.selectorCacheHits++;
+	} else {
+		g_sci->_vmStats.selectorCacheMisses++;
+		entry.pos = obj->getPos();
+		entry.selector = selectorId;
+		entry.type = findSelector(segMan, obj, selectorId, entry.varIndex, entry.func);
+	}
+
+	if (entry.type == kSelectorVariable && varp) {
+		varp->obj = obj_location;
+		varp->varindex = entry.varIndex;
+	} else if (entry.type == kSelectorMethod && fptr) {
+		*fptr = entry.func;
+	}
+
+	return entry.type;
+}
+
 } // End of namespace Sci
@@ -22,6 +22,7 @@
 #include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/system.h"
 
 #include "sci/sci.h"
 #include "sci/console.h"
@@ -541,8 +542,34 @@ uint32 findOffset(const int16 relOffset, const Script *scr, const uint32 pcOffse
 	return offset;
 }
 
+/**
+ * Accumulates the time spent in the outermost run_vm call into
+ * VMStats::runTime. Nested calls (e.g. from kernel functions invoking
+ * selectors) are already covered by their caller.
+ */
+class VMRunTimer {
+public:
+	VMRunTimer() {
+		if (!_depth++)
+			_start = g_system->getMillis(true);
+	}
+
+	~VMRunTimer() {
+		if (!--_depth)
+			g_sci->_vmStats.runTime += g_system->getMillis(true) - _start;
+	}
+
+private:
+	static int _depth;
+	static uint32 _start;
+};
+
+int VMRunTimer::_depth = 0;
+uint32 VMRunTimer::_start = 0;
+
 void run_vm(EngineState *s) {
 	assert(s);
+	VMRunTimer timer;
 
 	int temp;
 	reg_t r_temp; // Temporary register
@@ -624,9 +651,12 @@ void run_vm(EngineState *s) {
 			error("run_vm(): program counter gone astray, addr: %d, code buffer size: %d",
 			s->xs->addr.pc.getOffset(), scr->getBufSize());
 
-		// Get opcode
-		byte extOpcode;
-		s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		// Get opcode. The parameters are copied, since the instruction cache
+		// may grow (and move) while a kernel call runs nested scripts.
+		const PMachineInstruction &instruction = scr->getInstruction(s->xs->addr.pc.getOffset());
+		const byte extOpcode = instruction.extOpcode;
+		memcpy(opparams, instruction.opparams, sizeof(opparams));
+		s->xs->addr.pc.incOffset(instruction.size);
 		const byte opcode = extOpcode >> 1;
 		//debug("%s: %d, %d, %d, %d, acc = %04x:%04x, script %d, local script %d", opcodeNames[opcode], opparams[0], opparams[1], opparams[2], opparams[3], PRINT_REG(s->r_acc), scr->getScriptNumber(), local_script->getScriptNumber());
 
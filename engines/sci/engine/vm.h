@@ -416,6 +416,16 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
  */
 int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4]);
 
+/**
+ * A PMachine instruction as parsed by readPMachineInstruction, kept in the
+ * instruction cache of its script so that it is only decoded once.
+ */
+struct PMachineInstruction {
+	int16 opparams[4]; ///< Parameters of the instruction
+	uint16 size;       ///< Length of the instruction in bytes
+	byte extOpcode;    ///< "Extended" opcode of the instruction
+};
+
 /**
  * Finds the script-absolute offset of a relative object offset.
  *
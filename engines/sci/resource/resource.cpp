@@ -420,6 +420,28 @@ void ResourceManager::disposeVolumeFileStream(Common::SeekableReadStream *fileSt
 	// deleted from _volumeFiles
 }
 
+void ResourceManager::prefetchResource(ResourceId id) {
+	Resource *res = testResource(id);
+	if (!res || res->_status != kResStatusNoMalloc)
+		return;
+
+	// Only resources stored directly in volume files can be read ahead,
+	// patches and chunks are either small or already in memory
+	ResSourceType sourceType = res->_source->getSourceType();
+	if (sourceType != kSourceVolume && sourceType != kSourceAudioVolume)
+		return;
+
+	Common::SeekableReadStream *fileStream = getVolumeFile(res->_source);
+	if (!fileStream)
+		return;
+
+	uint32 len = res->size() ? res->size() : (uint32)RESOURCE_PREFETCH_SIZE;
+	debugC(2, kDebugLevelResMan, "Prefetching %s (%u bytes at offset %d)", id.toString().c_str(), len, res->_fileOffset);
+	fileStream->prefetch(res->_fileOffset, len);
+
+	disposeVolumeFileStream(fileStream, res->_source);
+}
+
 void ResourceManager::loadResource(Resource *res) {
 	res->_source->loadResource(this, res);
 	if (_patcher) {
@@ -1008,6 +1030,7 @@ void ResourceManager::init() {
 	_memoryLocked = 0;
 	_memoryLRU = 0;
 	_LRU.clear();
+	_cacheStats = ResourceCacheStats();
 	_resMap.clear();
 	_audioMapSCI1 = nullptr;
 #ifdef ENABLE_SCI32
@@ -1081,6 +1104,17 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+	// Allow users to trade memory for fewer decompressions, e.g. on
+	// large SCI32 games. The value is given in KiB.
+	if (g_sci && ConfMan.hasKey("resource_cache_size")) {
+		int cacheSize = ConfMan.getInt("resource_cache_size");
+		if (cacheSize > 0)
+			_maxMemoryLRU = MIN(cacheSize, INT_MAX / 1024) * 1024;
+		else
+			warning("resMan: Ignoring invalid resource_cache_size %d", cacheSize);
+	}
+	debugC(1, kDebugLevelResMan, "resMan: Resource cache size is %d KiB", _maxMemoryLRU / 1024);
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1127,7 +1161,7 @@ void ResourceManager::removeFromLRU(Resource *res) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+	_LRU.erase(res->_lruEntry);
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1138,6 +1172,7 @@ void ResourceManager::addToLRU(Resource *res) {
 		return;
 	}
 	_LRU.push_front(res);
+	res->_lruEntry = _LRU.begin();
 	_memoryLRU += res->size();
 #ifdef SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
@@ -1153,6 +1188,7 @@ void ResourceManager::freeOldResources() {
 		Resource *goner = _LRU.back();
 		removeFromLRU(goner);
 		goner->unalloc();
+		_cacheStats.evictions++;
 #ifdef SCI_VERBOSE_RESMAN
 		debug("resMan-debug: LRU: Freeing %s (%d bytes)", goner->_id.toString().c_str(), goner->size);
 #endif
@@ -1195,15 +1231,21 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return nullptr;
 
-	if (retval->_status == kResStatusNoMalloc)
+	if (retval->_status == kResStatusNoMalloc) {
+		_cacheStats.misses++;
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
-		// The resource is removed from its current position
-		// in the LRU list because it has been requested
-		// again. Below, it will either be locked, or it
-		// will be added back to the LRU list at the 'most
-		// recent' position.
-		removeFromLRU(retval);
+		if (retval->data())
+			_cacheStats.bytesDecompressed += retval->size();
+	} else {
+		_cacheStats.hits++;
+		if (retval->_status == kResStatusEnqueued)
+			// The resource is removed from its current position
+			// in the LRU list because it has been requested
+			// again. Below, it will either be locked, or it
+			// will be added back to the LRU list at the 'most
+			// recent' position.
+			removeFromLRU(retval);
+	}
 
 	// Unless an error occurred, the resource is now either
 	// locked or allocated, but never queued or freed.
@@ -76,7 +76,8 @@ enum ResourceErrorCodes {
 };
 
 enum {
-	MAX_OPENED_VOLUMES = 5 ///< Max number of simultaneously opened volumes
+	MAX_OPENED_VOLUMES = 5, ///< Max number of simultaneously opened volumes
+	RESOURCE_PREFETCH_SIZE = 64 * 1024 ///< Bytes read ahead for a resource of unknown size
 };
 
 enum ResourceType {
@@ -309,6 +310,7 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	Common::List<Resource *>::iterator _lruEntry; /**< Position in the LRU list, valid while enqueued */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -323,6 +325,16 @@ protected:
 
 typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
 
+/** Counters describing how well the resource cache is doing */
+struct ResourceCacheStats {
+	uint32 hits;              ///< findResource() calls served from memory
+	uint32 misses;            ///< findResource() calls that had to load the resource
+	uint32 evictions;         ///< Resources freed to stay within the memory budget
+	uint64 bytesDecompressed; ///< Resource bytes produced by loading from disk
+
+	ResourceCacheStats() : hits(0), misses(0), evictions(0), bytesDecompressed(0) {}
+};
+
 class IntMapResourceSource;
 class ResourceManager {
 	// FIXME: These 'friend' declarations are meant to be a temporary hack to
@@ -380,6 +392,24 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Returns the resource cache counters, for the debugger.
+	 */
+	const ResourceCacheStats &getCacheStats() const { return _cacheStats; }
+	void resetCacheStats() { _cacheStats = ResourceCacheStats(); }
+
+	int getMaxMemoryLRU() const { return _maxMemoryLRU; }
+	int getMemoryLRU() const { return _memoryLRU; }
+	int getMemoryLocked() const { return _memoryLocked; }
+
+	/**
+	 * Hints that a resource is going to be needed soon, so that its volume
+	 * file can start reading the data in the background. The resource is
+	 * not loaded or locked; a later findResource() call does that.
+	 * @param id	The resource to prefetch
+	 */
+	void prefetchResource(ResourceId id);
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -502,6 +532,7 @@ protected:
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	ResourceCacheStats _cacheStats;
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
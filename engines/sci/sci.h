@@ -342,6 +342,8 @@ public:
 	opcode_format (*_opcode_formats)[4];
 
 	DebugState _debugState;
+	VMStats _vmStats;
+	GCStats _gcStats;
 	uint32 _speedThrottleDelay; // kGameIsRestarting maximum delay
 
 	Common::MacResManager *getMacExecutable() { return &_macExecutable; }
@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/config-manager.h"
 #include "common/system.h"
 #include "scumm/actor.h"
 #include "scumm/charset.h"
@@ -216,9 +217,13 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+
+	_cacheStrips = false;
+	_stripCachePalette = 0;
 }
 
 Gdi::~Gdi() {
+	flushStripCache();
 }
 
 GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(nullptr) {
@@ -282,9 +287,17 @@ void Gdi::init() {
 		// the backbuf (thus we have to treat the right border separately).
 		_numStrips += 1;
 	}
+
+	// Memory budget (in KiB) for decoded background strips; 0 disables the cache
+	int stripCacheSize = 1024;
+	if (ConfMan.hasKey("strip_cache_size"))
+		stripCacheSize = CLIP(ConfMan.getInt("strip_cache_size"), 0, 1024 * 1024);
+	flushStripCache();
+	_stripCache.setMaxSize(stripCacheSize * 1024);
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	flushStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -1178,7 +1191,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbCacheStrips);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -2361,8 +2374,19 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_vertStripNextInc = height * vs->pitch - 1 * vs->format.bytesPerPixel;
 
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
+	_cacheStrips = (flag & dbCacheStrips) && vs->number == kMainVirtScreen && vs->format.bytesPerPixel == 1;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	// Cached strips were decoded through the room palette map, which scripts
+	// may change at any time; drop them if it is not the one they were made with.
+	if (_cacheStrips && _stripCache.getSize()) {
+		uint32 paletteHash = getRoomPaletteHash();
+		if (paletteHash != _stripCachePalette) {
+			flushStripCache();
+			_stripCachePalette = paletteHash;
+		}
+	}
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -2526,6 +2550,12 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 		return result;
 	}
 
+	// Only the room background is cached: other images, e.g. objects or
+	// cursors, may live in resources which get purged and reallocated while
+	// we stay in the same room.
+	if (_cacheStrips)
+		return decompressCachedBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+
 	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
 }
 
@@ -2968,6 +2998,40 @@ void Gdi::resetBackground(int top, int bottom, int strip) {
 	}
 }
 
+bool Gdi::decompressCachedBitmap(byte *dst, int dstPitch, const byte *src, int numLinesToProcess) {
+	if (!_stripCache.getMaxSize())
+		return decompressBitmap(dst, dstPitch, src, numLinesToProcess);
+
+	if (_stripCache.fetch(src, dst, dstPitch, numLinesToProcess))
+		return false;
+
+	if (decompressBitmap(dst, dstPitch, src, numLinesToProcess))
+		return true;	// Transparent strips depend on what is already on screen
+
+	if (!_stripCache.getSize())
+		_stripCachePalette = getRoomPaletteHash();
+	_stripCache.store(src, dst, dstPitch, numLinesToProcess);
+	return false;
+}
+
+void Gdi::flushStripCache() {
+	if (_stripCache.getNumStrips()) {
+		debugC(DEBUG_GENERAL, "Gdi: flushing %u decoded strips (%u bytes, %u hits, %u misses)",
+			_stripCache.getNumStrips(), _stripCache.getSize(), _stripCache.getHits(), _stripCache.getMisses());
+	}
+
+	_stripCache.flush();
+	_stripCachePalette = 0;
+}
+
+uint32 Gdi::getRoomPaletteHash() const {
+	// FNV-1a over the room palette map, plus the modifier applied on top of it
+	uint32 hash = 2166136261u ^ _paletteMod;
+	for (int i = 0; i < 256; i++)
+		hash = (hash ^ _vm->_roomPalette[i]) * 16777619u;
+	return hash;
+}
+
 bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLinesToProcess) {
 	assert(numLinesToProcess);
 
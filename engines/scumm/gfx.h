@@ -27,6 +27,8 @@
 
 #include "graphics/surface.h"
 
+#include "scumm/strip_cache.h"
+
 namespace Scumm {
 
 class ScummEngine;
@@ -304,6 +306,16 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/** Flag which is true when the room background is being rendered, false otherwise. */
+	bool _cacheStrips;
+
+	/**
+	 * Decoded opaque strips of the current room background. They are only
+	 * valid while the room resource stays loaded, i.e. until roomChanged().
+	 */
+	StripCache _stripCache;
+	uint32 _stripCachePalette;
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -332,6 +344,11 @@ protected:
 	void drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height, const bool transpCheck) const;
 	virtual void writeRoomColor(byte *dst, byte color) const;
 
+	/* Decoded strip cache */
+	bool decompressCachedBitmap(byte *dst, int dstPitch, const byte *src, int numLinesToProcess);
+	void flushStripCache();
+	uint32 getRoomPaletteHash() const;
+
 	/* Mask decompressors */
 	void decompressMaskImgOr(byte *dst, const byte *src, int height) const;
 	void decompressMaskImg(byte *dst, const byte *src, int height) const;
@@ -380,7 +397,8 @@ public:
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbCacheStrips   = 1 << 4
 	};
 };
 
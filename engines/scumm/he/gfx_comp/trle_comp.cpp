@@ -423,168 +423,160 @@ void Wiz::trleFLIPDecompressPrim(
 		&sourceRect, extraPtr, conversionTable, functionPtr);
 }
 
+// The pixel helpers below are called for every run of a TRLE line, so they
+// pick the pixel depth and the mixing masks once per run rather than once per
+// pixel. This leaves simple loops over the destination which the compiler is
+// able to unroll and vectorize.
+
+static inline WizRawPixel16 trleFLIPConvert16(byte value, const WizRawPixel *conversionTable) {
+	return FROM_LE_16(*(((const WizRawPixel16 *)conversionTable) + value));
+}
+
 void Wiz::trleFLIPFiftyFiftyMixPixelMemset(WizRawPixel *dstPtr, WizRawPixel mixColor, int size) {
-	WizRawPixel adjustedColor = WIZRAWPIXEL_50_50_PREMIX_COLOR(mixColor);
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+	const WizRawPixel hiBits = WIZRAWPIXEL_HI_BITS;
+	const WizRawPixel adjustedColor = (mixColor & hiBits) >> 1;
 
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			*dst8 = WIZRAWPIXEL_50_50_MIX(
-				adjustedColor, WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
-			dst8++;
-		} else {
-			*dst16 = WIZRAWPIXEL_50_50_MIX(
-				adjustedColor, WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst16));
-			dst16++;
-		}
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[i] = (WizRawPixel8)(adjustedColor + ((dst8[i] & hiBits) >> 1));
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst16[i] = (WizRawPixel16)(adjustedColor + ((dst16[i] & hiBits) >> 1));
 	}
 }
 
 void Wiz::trleFLIPFiftyFiftyMixForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+	const WizRawPixel hiBits = WIZRAWPIXEL_HI_BITS;
 
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst8 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
-			dst8++;
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst16 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst16));
-			dst16++;
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[i] = (WizRawPixel8)(((srcPtr[i] & hiBits) >> 1) + ((dst8[i] & hiBits) >> 1));
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++) {
+			WizRawPixel srcColor = trleFLIPConvert16(srcPtr[i], conversionTable);
+			dst16[i] = (WizRawPixel16)(((srcColor & hiBits) >> 1) + ((dst16[i] & hiBits) >> 1));
 		}
 	}
 }
 
 void Wiz::trleFLIPFiftyFiftyMixBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+	const WizRawPixel hiBits = WIZRAWPIXEL_HI_BITS;
 
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst8 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
-			dst8--;
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst16 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst16));
-			dst16--;
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[-i] = (WizRawPixel8)(((srcPtr[i] & hiBits) >> 1) + ((dst8[-i] & hiBits) >> 1));
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++) {
+			WizRawPixel srcColor = trleFLIPConvert16(srcPtr[i], conversionTable);
+			dst16[-i] = (WizRawPixel16)(((srcColor & hiBits) >> 1) + ((dst16[-i] & hiBits) >> 1));
 		}
 	}
 }
 
+static inline WizRawPixel trleFLIPAdditiveMix(WizRawPixel a, WizRawPixel b, int rMask, int gMask, int bMask) {
+	return MIN<int>(rMask, (a & rMask) + (b & rMask)) |
+		   MIN<int>(gMask, (a & gMask) + (b & gMask)) |
+		   MIN<int>(bMask, (a & bMask) + (b & bMask));
+}
+
+static inline WizRawPixel trleFLIPSubtractiveMix(WizRawPixel a, WizRawPixel b, int rMask, int gMask, int bMask, int loR, int loG, int loB) {
+	return MAX<int>(loR, (a & rMask) - (b & rMask)) |
+		   MAX<int>(loG, (a & gMask) - (b & gMask)) |
+		   MAX<int>(loB, (a & bMask) - (b & bMask));
+}
+
 void Wiz::trleFLIPAdditivePixelMemset(WizRawPixel *dstPtr, WizRawPixel mixColor, int size) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+	const int rMask = WIZRAWPIXEL_R_MASK, gMask = WIZRAWPIXEL_G_MASK, bMask = WIZRAWPIXEL_B_MASK;
+	const WizRawPixel color = FROM_LE_16(mixColor);
 
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel workColor = *dst8;
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, FROM_LE_16(mixColor));
-		} else {
-			WizRawPixel workColor = *dst16;
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_ADDITIVE_MIX(workColor, FROM_LE_16(mixColor));
-		}
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[i] = (WizRawPixel8)trleFLIPAdditiveMix(dst8[i], color, rMask, gMask, bMask);
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst16[i] = (WizRawPixel16)trleFLIPAdditiveMix(dst16[i], color, rMask, gMask, bMask);
 	}
 }
 
 void Wiz::trleFLIPAdditiveForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
+	const int rMask = WIZRAWPIXEL_R_MASK, gMask = WIZRAWPIXEL_G_MASK, bMask = WIZRAWPIXEL_B_MASK;
 
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
-
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		}
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[i] = (WizRawPixel8)trleFLIPAdditiveMix(dst8[i], srcPtr[i], rMask, gMask, bMask);
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst16[i] = (WizRawPixel16)trleFLIPAdditiveMix(dst16[i], trleFLIPConvert16(srcPtr[i], conversionTable), rMask, gMask, bMask);
 	}
 }
 
 void Wiz::trleFLIPAdditiveBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
-
-			*dst8-- = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
+	const int rMask = WIZRAWPIXEL_R_MASK, gMask = WIZRAWPIXEL_G_MASK, bMask = WIZRAWPIXEL_B_MASK;
 
-			*dst16-- = (WizRawPixel16)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		}
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[-i] = (WizRawPixel8)trleFLIPAdditiveMix(dst8[-i], srcPtr[i], rMask, gMask, bMask);
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst16[-i] = (WizRawPixel16)trleFLIPAdditiveMix(dst16[-i], trleFLIPConvert16(srcPtr[i], conversionTable), rMask, gMask, bMask);
 	}
 }
+
 void Wiz::trleFLIPSubtractivePixelMemset(WizRawPixel *dstPtr, WizRawPixel mixColor, int size) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+	const int rMask = WIZRAWPIXEL_R_MASK, gMask = WIZRAWPIXEL_G_MASK, bMask = WIZRAWPIXEL_B_MASK;
+	const int loR = WIZRAWPIXEL_LO_R_BIT, loG = WIZRAWPIXEL_LO_G_BIT, loB = WIZRAWPIXEL_LO_B_BIT;
+	const WizRawPixel color = FROM_LE_16(mixColor);
 
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel workColor = *dst8;
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, FROM_LE_16(mixColor));
-		} else {
-			WizRawPixel workColor = *dst16;
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, FROM_LE_16(mixColor));
-		}
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[i] = (WizRawPixel8)trleFLIPSubtractiveMix(dst8[i], color, rMask, gMask, bMask, loR, loG, loB);
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst16[i] = (WizRawPixel16)trleFLIPSubtractiveMix(dst16[i], color, rMask, gMask, bMask, loR, loG, loB);
 	}
 }
 
 void Wiz::trleFLIPSubtractiveForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
-
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
+	const int rMask = WIZRAWPIXEL_R_MASK, gMask = WIZRAWPIXEL_G_MASK, bMask = WIZRAWPIXEL_B_MASK;
+	const int loR = WIZRAWPIXEL_LO_R_BIT, loG = WIZRAWPIXEL_LO_G_BIT, loB = WIZRAWPIXEL_LO_B_BIT;
 
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		}
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[i] = (WizRawPixel8)trleFLIPSubtractiveMix(dst8[i], srcPtr[i], rMask, gMask, bMask, loR, loG, loB);
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst16[i] = (WizRawPixel16)trleFLIPSubtractiveMix(dst16[i], trleFLIPConvert16(srcPtr[i], conversionTable), rMask, gMask, bMask, loR, loG, loB);
 	}
 }
 
 void Wiz::trleFLIPSubtractiveBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
-
-			*dst8-- = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
+	const int rMask = WIZRAWPIXEL_R_MASK, gMask = WIZRAWPIXEL_G_MASK, bMask = WIZRAWPIXEL_B_MASK;
+	const int loR = WIZRAWPIXEL_LO_R_BIT, loG = WIZRAWPIXEL_LO_G_BIT, loB = WIZRAWPIXEL_LO_B_BIT;
 
-			*dst16-- = (WizRawPixel16)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		}
+	if (!_uses16BitColor) {
+		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst8[-i] = (WizRawPixel8)trleFLIPSubtractiveMix(dst8[-i], srcPtr[i], rMask, gMask, bMask, loR, loG, loB);
+	} else {
+		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			dst16[-i] = (WizRawPixel16)trleFLIPSubtractiveMix(dst16[-i], trleFLIPConvert16(srcPtr[i], conversionTable), rMask, gMask, bMask, loR, loG, loB);
 	}
 }
 
@@ -600,78 +592,48 @@ void Wiz::trleFLIPRemapDestPixels(WizRawPixel *dstPtr, int size, const byte *loo
 }
 
 void Wiz::trleFLIPForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16++ = (WizRawPixel16)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		} else {
-			*buf8++ = (WizRawPixel8)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		}
-	}
-
-	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
+	if (!_uses16BitColor) {
+		memcpy(dstPtr, srcPtr, size);
 	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			buf16[i] = trleFLIPConvert16(srcPtr[i], conversionTable);
 	}
 }
 
 void Wiz::trleFLIPBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16-- = (WizRawPixel16)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		} else {
-			*buf8-- = (WizRawPixel8)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		}
-	}
-
-	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
+	if (!_uses16BitColor) {
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			buf8[-i] = srcPtr[i];
 	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			buf16[-i] = trleFLIPConvert16(srcPtr[i], conversionTable);
 	}
 }
 
 void Wiz::trleFLIPForwardLookupPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16++ = (WizRawPixel16)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		} else {
-			*buf8++ = (WizRawPixel8)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		}
-	}
-
-	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
+	if (!_uses16BitColor) {
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			buf8[i] = lookupTable[srcPtr[i]];
 	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			buf16[i] = trleFLIPConvert16(lookupTable[srcPtr[i]], conversionTable);
 	}
 }
 
 void Wiz::trleFLIPBackwardsLookupPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16-- = (WizRawPixel16)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		} else {
-			*buf8-- = (WizRawPixel8)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		}
-	}
-
-	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
+	if (!_uses16BitColor) {
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			buf8[-i] = lookupTable[srcPtr[i]];
 	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+		for (int i = 0; i < size; i++)
+			buf16[-i] = trleFLIPConvert16(lookupTable[srcPtr[i]], conversionTable);
 	}
 }
 
@@ -615,6 +615,7 @@ void IMuseDigital::dispatchProcessDispatches(IMuseDigiTrack *trackPtr, int feedS
 			srcBuf = streamerGetStreamBuffer(dispatchPtr->streamPtr, effRemainingAudio);
 			if (!srcBuf) {
 				dispatchPtr->streamErrFlag = 1;
+				_statsStreamStarvations++;
 				if (dispatchPtr->fadeBuf && dispatchPtr->fadeSyncFlag)
 					dispatchPtr->fadeSyncDelta += feedSize;
 
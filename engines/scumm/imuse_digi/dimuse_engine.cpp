@@ -88,6 +88,7 @@ IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, int sampleRate, Audio::Mixer *
 	_isEngineDisabled = false;
 	_checkForUnderrun = false;
 	_underrunCooldown = 0;
+	resetStats();
 
 	_audioNames = nullptr;
 	_numAudioNames = 0;
@@ -1119,4 +1120,22 @@ void IMuseDigital::listGroups() {
 	_vm->getDebugger()->debugPrintf("\tMUSICEFF: %3d\n\n", _groupsHandler->getGroupVol(DIMUSE_GROUP_MUSICEFF));
 }
 
+void IMuseDigital::listStats() {
+	_vm->getDebugger()->debugPrintf("Mixer callback statistics:\n");
+	_vm->getDebugger()->debugPrintf("\tCallbacks:          %u\n", _statsCallbacks);
+	_vm->getDebugger()->debugPrintf("\tOutput underruns:   %u\n", _statsUnderruns);
+	_vm->getDebugger()->debugPrintf("\tStream starvations: %u\n", _statsStreamStarvations);
+	_vm->getDebugger()->debugPrintf("\tQueued buffers:     %d (nominal %d)\n", _maxQueuedStreams, _nominalBufferCount);
+	_vm->getDebugger()->debugPrintf("\tMix time:           %u ms total, %u ms max, %.2f ms avg\n\n",
+		_statsMixTime, _statsMaxMixTime, _statsCallbacks ? (double)_statsMixTime / _statsCallbacks : 0.0);
+}
+
+void IMuseDigital::resetStats() {
+	_statsCallbacks = 0;
+	_statsUnderruns = 0;
+	_statsStreamStarvations = 0;
+	_statsMixTime = 0;
+	_statsMaxMixTime = 0;
+}
+
 } // End of namespace Scumm
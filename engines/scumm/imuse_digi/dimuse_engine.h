@@ -86,6 +86,13 @@ private:
 	bool _isEngineDisabled;
 	bool _checkForUnderrun;
 	int _underrunCooldown;
+
+	// Callback statistics, shown by the "imuse stats" debugger command
+	uint32 _statsCallbacks;
+	uint32 _statsUnderruns;
+	uint32 _statsStreamStarvations;
+	uint32 _statsMixTime;
+	uint32 _statsMaxMixTime;
 	bool _lowLatencyMode;
 
 	int _internalFeedSize;
@@ -439,6 +446,8 @@ public:
 	void listCues();
 	void listTracks();
 	void listGroups();
+	void listStats();
+	void resetStats();
 };
 
 } // End of namespace Scumm
@@ -169,6 +169,7 @@ void IMuseDigital::tracksCallback() {
 	// smooth audio hopefully on every device.
 	if (_internalMixer->_stream->endOfData() && _checkForUnderrun) {
 		debug(5, "IMuseDigital::tracksCallback(): WARNING: audio buffer underrun, adapting the buffer queue count...");
+		_statsUnderruns++;
 
 		adaptBufferCount();
 
@@ -196,6 +197,8 @@ void IMuseDigital::tracksCallback() {
 				}
 			}
 
+			uint32 mixStart = g_system->getMillis(true);
+
 			_internalMixer->clearMixerBuffer();
 			if (_isEarlyDiMUSE && _splayer && _splayer->isAudioCallbackEnabled()) {
 				_splayer->processDispatches(_outputFeedSize);
@@ -217,6 +220,12 @@ void IMuseDigital::tracksCallback() {
 
 			_internalMixer->loop(&_outputAudioBuffer, _outputFeedSize);
 
+			uint32 mixTime = g_system->getMillis(true) - mixStart;
+			_statsCallbacks++;
+			_statsMixTime += mixTime;
+			if (mixTime > _statsMaxMixTime)
+				_statsMaxMixTime = mixTime;
+
 			// The Dig tries to write a second time
 			if (!_isEarlyDiMUSE && _vm->_game.id == GID_DIG) {
 				waveOutWrite(&_outputAudioBuffer, _outputFeedSize, _outputSampleRate);
@@ -89,6 +89,7 @@ MODULE_OBJS := \
 	soundcd.o \
 	soundse.o \
 	string.o \
+	strip_cache.o \
 	usage_bits.o \
 	util.o \
 	vars.o \
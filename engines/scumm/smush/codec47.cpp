@@ -55,6 +55,12 @@ namespace Scumm {
 
 #endif
 
+#define COPY_8X1_LINE(dst, src) \
+	memcpy((dst), (src), 8)
+
+#define FILL_8X1_LINE(dst, val) \
+	memset((dst), (val), 8)
+
 #define FILL_4X1_LINE(dst, val) \
 	do {                        \
 		(dst)[0] = val;         \
@@ -188,6 +194,7 @@ void SmushDeltaGlyphsDecoder::makeTablesInterpolation(int sideLength) {
 	}
 
 	s = 0;
+	byte *glyphMask = (sideLength == 8) ? &_glyphMaskBig[0][0] : &_glyphMaskSmall[0][0];
 	for (x = 0; x < 16; x++) {
 		x0 = xGlyph[x];
 		y0 = yGlyph[x];
@@ -274,6 +281,12 @@ void SmushDeltaGlyphsDecoder::makeTablesInterpolation(int sideLength) {
 				}
 			}
 
+			// Pixels set in the interpolation table take the first glyph color,
+			// all others the second one; keep that as a byte mask per pixel, so
+			// the decoder can draw a glyph one line at a time.
+			for (i = 0; i < sideLength * sideLength; i++)
+				*glyphMask++ = tableSmallBig[i] ? 0xFF : 0x00;
+
 			if (sideLength == 8) {
 				for (i = 64 - 1; i >= 0; i--) {
 					if (tableSmallBig[i] != 0) {
@@ -425,20 +438,16 @@ void SmushDeltaGlyphsDecoder::level2(byte *d_dst) {
 			d_dst += _dPitch;
 		}
 	} else if (code == DRAW_GLYPH) {
-		byte *tmpPtr = _tableSmall + *_dSrc++ * 128;
-		int32 l = tmpPtr[96];
-		byte val = *_dSrc++;
-		int16 *tmpPtr2 = (int16 *)tmpPtr;
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
-		}
-		l = tmpPtr[97];
-		val = *_dSrc++;
-		tmpPtr2 = (int16 *)(tmpPtr + 32);
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
+		const byte *mask = _glyphMaskSmall[*_dSrc++];
+		uint32 fg = *_dSrc++ * 0x01010101U;
+		uint32 bg = *_dSrc++ * 0x01010101U;
+		for (i = 0; i < 4; i++) {
+			uint32 m, line;
+			memcpy(&m, mask, 4);
+			line = (fg & m) | (bg & ~m);
+			memcpy(d_dst, &line, 4);
+			mask += 4;
+			d_dst += _dPitch;
 		}
 	} else if (code == COPY_PREV_BUFFER) {
 		tmp = _offset2;
@@ -463,8 +472,7 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 	if (code < MOTION_OFFSET_TABLE_SIZE) {
 		tmp = _table[code] + _offset1;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _dPitch;
 		}
 	} else if (code == PROCESS_SUBBLOCKS) {
@@ -478,39 +486,31 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 	} else if (code == FILL_SINGLE_COLOR) {
 		byte t = *_dSrc++;
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _dPitch;
 		}
 	} else if (code == DRAW_GLYPH) {
-		tmp = *_dSrc++;
-		byte *tmpPtr = _tableBig + tmp * 388;
-		byte l = tmpPtr[384];
-		byte val = *_dSrc++;
-		int16 *tmpPtr2 = (int16 *)tmpPtr;
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
-		}
-		l = tmpPtr[385];
-		val = *_dSrc++;
-		tmpPtr2 = (int16 *)(tmpPtr + 128);
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
+		const byte *mask = _glyphMaskBig[*_dSrc++];
+		uint64 fg = *_dSrc++ * 0x0101010101010101ULL;
+		uint64 bg = *_dSrc++ * 0x0101010101010101ULL;
+		for (i = 0; i < 8; i++) {
+			uint64 m, line;
+			memcpy(&m, mask, 8);
+			line = (fg & m) | (bg & ~m);
+			memcpy(d_dst, &line, 8);
+			mask += 8;
+			d_dst += _dPitch;
 		}
 	} else if (code == COPY_PREV_BUFFER) {
 		tmp = _offset2;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _dPitch;
 		}
 	} else {
 		byte t = _paramPtr[code];
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _dPitch;
 		}
 	}
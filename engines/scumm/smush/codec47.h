@@ -41,6 +41,8 @@ private:
 	byte *_tableBig;
 	byte *_tableSmall;
 	int16 _table[256];
+	byte _glyphMaskBig[256][64];
+	byte _glyphMaskSmall[256][16];
 	int32 _frameSize;
 	int _width, _height;
 
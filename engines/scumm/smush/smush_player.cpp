@@ -253,6 +253,10 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital, Insa
 	_pauseStartTime = 0;
 	_pauseTime = 0;
 
+	_decodedFrames = 0;
+	_decodeTime = 0;
+	_maxDecodeTime = 0;
+
 	memset(_pal, 0, sizeof(_pal));
 	memset(_deltaPal, 0, sizeof(_deltaPal));
 	memset(_shiftedDeltaPal, 0, sizeof(_shiftedDeltaPal));
@@ -287,6 +291,10 @@ void SmushPlayer::init(int32 speed) {
 	_speed = speed;
 	_endOfFile = false;
 
+	_decodedFrames = 0;
+	_decodeTime = 0;
+	_maxDecodeTime = 0;
+
 	_vm->_smushVideoShouldFinish = false;
 	_vm->_smushActive = true;
 
@@ -312,6 +320,11 @@ void SmushPlayer::init(int32 speed) {
 void SmushPlayer::release() {
 	_vm->_smushVideoShouldFinish = true;
 
+	if (_decodedFrames) {
+		debugC(DEBUG_SMUSH, "Smush stats: decoded %d frames in %d ms (average %d us, max %d ms, budget %d ms per frame)",
+			_decodedFrames, _decodeTime, (uint32)((uint64)_decodeTime * 1000 / _decodedFrames), _maxDecodeTime, _speed > 0 ? 1000 / _speed : 0);
+	}
+
 	for (int i = 0; i < 5; i++) {
 		delete _sf[i];
 		_sf[i] = nullptr;
@@ -873,6 +886,10 @@ void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
 		_vm->_insane->procPreRendering();
 	}
 
+	// Time the whole frame, a single frame object usually decodes in
+	// less than a millisecond
+	const uint32 startTime = _vm->_system->getMillis(true);
+
 	while (frameSize > 0) {
 		const uint32 subType = b.readUint32BE();
 		const int32 subSize = b.readUint32BE();
@@ -931,6 +948,11 @@ void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
 		}
 	}
 
+	const uint32 decodeTime = _vm->_system->getMillis(true) - startTime;
+	_decodeTime += decodeTime;
+	_maxDecodeTime = MAX(_maxDecodeTime, decodeTime);
+	_decodedFrames++;
+
 	if (_insanity) {
 		_vm->_insane->procPostRendering(_dst, 0, 0, 0, _frame, _nbframes-1);
 	}
@@ -147,6 +147,11 @@ private:
 	int32 _seekPos;
 	uint32 _seekFrame;
 
+	// Playback statistics, reported with the SMUSH debug channel
+	uint32 _decodedFrames;
+	uint32 _decodeTime;
+	uint32 _maxDecodeTime;
+
 	bool _skipNext;
 	uint32 _frame;
 
@@ -0,0 +1,91 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "scumm/strip_cache.h"
+
+namespace Scumm {
+
+StripCache::StripCache() : _size(0), _maxSize(0), _hits(0), _misses(0) {
+}
+
+StripCache::~StripCache() {
+	flush();
+}
+
+void StripCache::setMaxSize(uint32 maxSize) {
+	_maxSize = maxSize;
+	flush();
+}
+
+bool StripCache::fetch(const byte *src, byte *dst, int dstPitch, int height) {
+	DecodedStripMap::const_iterator it = _strips.find(src);
+	if (it == _strips.end() || it->_value.height != height) {
+		_misses++;
+		return false;
+	}
+
+	const byte *pixels = it->_value.pixels;
+	for (int h = 0; h < height; ++h, dst += dstPitch, pixels += 8)
+		memcpy(dst, pixels, 8);
+	_hits++;
+	return true;
+}
+
+void StripCache::store(const byte *src, const byte *dst, int dstPitch, int height) {
+	const uint32 size = height * 8;
+	if (size > _maxSize)
+		return;
+
+	DecodedStripMap::iterator it = _strips.find(src);
+	if (it != _strips.end()) {
+		free(it->_value.pixels);
+		_size -= it->_value.height * 8;
+		_strips.erase(it);
+	}
+	// When over budget, simply start over; this only happens in rooms larger
+	// than the budget, where keeping track of strip usage does not pay off.
+	if (_size + size > _maxSize)
+		flush();
+
+	DecodedStrip strip;
+	strip.height = height;
+	strip.pixels = (byte *)malloc(size);
+	if (!strip.pixels)
+		return;
+
+	byte *pixels = strip.pixels;
+	for (int h = 0; h < height; ++h, dst += dstPitch, pixels += 8)
+		memcpy(pixels, dst, 8);
+
+	_strips[src] = strip;
+	_size += size;
+}
+
+void StripCache::flush() {
+	for (DecodedStripMap::iterator it = _strips.begin(); it != _strips.end(); ++it)
+		free(it->_value.pixels);
+	_strips.clear();
+	_size = 0;
+	_hits = 0;
+	_misses = 0;
+}
+
+} // End of namespace Scumm
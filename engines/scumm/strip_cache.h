@@ -0,0 +1,77 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCUMM_STRIP_CACHE_H
+#define SCUMM_STRIP_CACHE_H
+
+#include "common/hashmap.h"
+#include "common/hash-ptr.h"
+
+namespace Scumm {
+
+/**
+ * Decoded copies of opaque 8 pixel wide strips, keyed by the start of
+ * their compressed data. Redrawing a strip already decoded (e.g. when
+ * scrolling back) then becomes a plain copy.
+ *
+ * The keys are raw pointers, so the cache must be flushed whenever the
+ * resource holding the compressed data may go away.
+ */
+class StripCache {
+public:
+	StripCache();
+	~StripCache();
+
+	/** Set the memory budget in bytes; 0 disables the cache. */
+	void setMaxSize(uint32 maxSize);
+	uint32 getMaxSize() const { return _maxSize; }
+	uint32 getSize() const { return _size; }
+	uint getNumStrips() const { return _strips.size(); }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+
+	/**
+	 * Copy the strip decoded from src to dst.
+	 * @return false if no strip of that height was stored for src
+	 */
+	bool fetch(const byte *src, byte *dst, int dstPitch, int height);
+
+	/** Remember the strip just decoded from src to dst. */
+	void store(const byte *src, const byte *dst, int dstPitch, int height);
+
+	void flush();
+
+private:
+	struct DecodedStrip {
+		int height;
+		byte *pixels;
+	};
+	typedef Common::HashMap<const byte *, DecodedStrip> DecodedStripMap;
+
+	DecodedStripMap _strips;
+	uint32 _size;
+	uint32 _maxSize;
+	uint32 _hits, _misses;
+};
+
+} // End of namespace Scumm
+
+#endif
@@ -84,6 +84,7 @@ protected:
 	FaceBufferMap _faceEBO;
 
 	void clearVertices();
+	void skinVertices(bool computeShadow, const Math::Vector3d &lightDirection);
 	void uploadVertices();
 	ActorVertex *createModelVBO(const Model *model);
 	uint32 *createFaceEBO(const Face *face);
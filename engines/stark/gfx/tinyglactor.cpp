@@ -96,7 +96,10 @@ void TinyGLActorRenderer::render(const Math::Vector3d &position, float direction
 
 	Common::Array<Face *> faces = _model->getFaces();
 	Common::Array<Material *> mats = _model->getMaterials();
-	const Common::Array<BoneNode *> &bones = _model->getBones();
+	Math::Matrix3 normalRotation = normalMatrix.getRotation();
+
+	updateBoneRotations();
+	skinVertices(drawShadow, lightDirection);
 
 	for (Common::Array<Face *>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
 		const Material *material = mats[(*face)->materialId];
@@ -118,62 +121,14 @@ void TinyGLActorRenderer::render(const Math::Vector3d &position, float direction
 				color = Math::Vector3d(material->r, material->g, material->b);
 			}
 			uint32 index = vertexIndices[i];
-			auto vertex = _faceVBO[index];
-			uint32 bone1 = vertex.bone1;
-			uint32 bone2 = vertex.bone2;
-			Math::Vector3d position1 = Math::Vector3d(vertex.pos1x, vertex.pos1y, vertex.pos1z);
-			Math::Vector3d position2 = Math::Vector3d(vertex.pos2x, vertex.pos2y, vertex.pos2z);
-			Math::Vector3d bone1Position = Math::Vector3d(bones[bone1]->_animPos.x(),
-			                                              bones[bone1]->_animPos.y(),
-			                                              bones[bone1]->_animPos.z());
-			Math::Vector3d bone2Position = Math::Vector3d(bones[bone2]->_animPos.x(),
-			                                              bones[bone2]->_animPos.y(),
-			                                              bones[bone2]->_animPos.z());
-			Math::Quaternion bone1Rotation = Math::Quaternion(bones[bone1]->_animRot.x(),
-			                                                  bones[bone1]->_animRot.y(),
-			                                                  bones[bone1]->_animRot.z(),
-			                                                  bones[bone1]->_animRot.w());
-			Math::Quaternion bone2Rotation = Math::Quaternion(bones[bone2]->_animRot.x(),
-			                                                  bones[bone2]->_animRot.y(),
-			                                                  bones[bone2]->_animRot.z(),
-			                                                  bones[bone2]->_animRot.w());
-			float boneWeight = vertex.boneWeight;
-			Math::Vector3d normal = Math::Vector3d(vertex.normalx, vertex.normaly, vertex.normalz);
-
-			// Compute the vertex position in eye-space
-			bone1Rotation.transform(position1);
-			position1 += bone1Position;
-			bone2Rotation.transform(position2);
-			position2 += bone2Position;
-			Math::Vector3d modelPosition = Math::Vector3d::interpolate(position2, position1, boneWeight);
-			vertex.x = modelPosition.x();
-			vertex.y = modelPosition.y();
-			vertex.z = modelPosition.z();
+			ActorVertex &vertex = _faceVBO[index];
+			// Compute the vertex position and normal in eye-space
 			Math::Vector4d modelEyePosition;
-			modelEyePosition = modelViewMatrix * Math::Vector4d(modelPosition.x(),
-			                                                    modelPosition.y(),
-			                                                    modelPosition.z(),
-			                                                    1.0);
-			// Compute the vertex normal in eye-space
-			Math::Vector3d n1 = normal;
-			bone1Rotation.transform(n1);
-			Math::Vector3d n2 = normal;
-			bone2Rotation.transform(n2);
-			Math::Vector3d modelNormal = Math::Vector3d(Math::Vector3d::interpolate(n2, n1, boneWeight)).getNormalized();
-			vertex.nx = modelNormal.x();
-			vertex.ny = modelNormal.y();
-			vertex.nz = modelNormal.z();
+			modelEyePosition = modelViewMatrix * Math::Vector4d(vertex.x, vertex.y, vertex.z, 1.0);
 			Math::Vector3d modelEyeNormal;
-			modelEyeNormal = normalMatrix.getRotation() * modelNormal;
+			modelEyeNormal = normalRotation * Math::Vector3d(vertex.nx, vertex.ny, vertex.nz);
 			modelEyeNormal.normalize();
 
-			if (drawShadow) {
-				Math::Vector3d shadowPosition = modelPosition + lightDirection * (-modelPosition.y() / lightDirection.y());
-				vertex.sx = shadowPosition.x();
-				vertex.sy = 0.0f;
-				vertex.sz = shadowPosition.z();
-			}
-
 			static const uint maxLights = 10;
 
 			assert(lights.size() >= 1);
@@ -230,7 +185,6 @@ void TinyGLActorRenderer::render(const Math::Vector3d &position, float direction
 			vertex.r = color.x();
 			vertex.g = color.y();
 			vertex.b = color.z();
-			_faceVBO[index] = vertex;
 		}
 
 		tglEnableClientState(TGL_VERTEX_ARRAY);
@@ -276,6 +230,44 @@ void TinyGLActorRenderer::render(const Math::Vector3d &position, float direction
 	}
 }
 
+void TinyGLActorRenderer::skinVertices(bool computeShadow, const Math::Vector3d &lightDirection) {
+	const Common::Array<BoneNode *> &bones = _model->getBones();
+	uint32 numVertices = _model->getVertices().size();
+
+	// Vertices are shared between many triangles, so animate each of them
+	// once here rather than once per face index when drawing
+	for (uint32 i = 0; i < numVertices; i++) {
+		ActorVertex &vertex = _faceVBO[i];
+		const Math::Matrix3 &bone1Rotation = _boneRotations[vertex.bone1];
+		const Math::Matrix3 &bone2Rotation = _boneRotations[vertex.bone2];
+		float boneWeight = vertex.boneWeight;
+
+		Math::Vector3d position1 = bone1Rotation * Math::Vector3d(vertex.pos1x, vertex.pos1y, vertex.pos1z);
+		position1 += bones[vertex.bone1]->_animPos;
+		Math::Vector3d position2 = bone2Rotation * Math::Vector3d(vertex.pos2x, vertex.pos2y, vertex.pos2z);
+		position2 += bones[vertex.bone2]->_animPos;
+		Math::Vector3d modelPosition = Math::Vector3d::interpolate(position2, position1, boneWeight);
+		vertex.x = modelPosition.x();
+		vertex.y = modelPosition.y();
+		vertex.z = modelPosition.z();
+
+		Math::Vector3d normal = Math::Vector3d(vertex.normalx, vertex.normaly, vertex.normalz);
+		Math::Vector3d n1 = bone1Rotation * normal;
+		Math::Vector3d n2 = bone2Rotation * normal;
+		Math::Vector3d modelNormal = Math::Vector3d(Math::Vector3d::interpolate(n2, n1, boneWeight)).getNormalized();
+		vertex.nx = modelNormal.x();
+		vertex.ny = modelNormal.y();
+		vertex.nz = modelNormal.z();
+
+		if (computeShadow) {
+			Math::Vector3d shadowPosition = modelPosition + lightDirection * (-modelPosition.y() / lightDirection.y());
+			vertex.sx = shadowPosition.x();
+			vertex.sy = 0.0f;
+			vertex.sz = shadowPosition.z();
+		}
+	}
+}
+
 void TinyGLActorRenderer::clearVertices() {
 	delete[] _faceVBO;
 	_faceVBO = nullptr;
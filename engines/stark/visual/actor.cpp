@@ -54,6 +54,32 @@ void VisualActor::setModel(Model *model) {
 	_modelIsDirty = true;
 }
 
+void VisualActor::updateBoneRotations() {
+	const Common::Array<BoneNode *> &bones = _model->getBones();
+	_boneRotations.resize(bones.size());
+
+	for (uint i = 0; i < bones.size(); i++) {
+		// This is the same linear map as Quaternion::transform
+		const Math::Quaternion &q = bones[i]->_animRot;
+		float x = q.x();
+		float y = q.y();
+		float z = q.z();
+		float w = q.w();
+		float d = 1.0f - 2.0f * (x * x + y * y + z * z);
+
+		Math::Matrix3 &m = _boneRotations[i];
+		m.setValue(0, 0, d + 2.0f * x * x);
+		m.setValue(0, 1, 2.0f * (x * y - w * z));
+		m.setValue(0, 2, 2.0f * (x * z + w * y));
+		m.setValue(1, 0, 2.0f * (x * y + w * z));
+		m.setValue(1, 1, d + 2.0f * y * y);
+		m.setValue(1, 2, 2.0f * (y * z - w * x));
+		m.setValue(2, 0, 2.0f * (x * z - w * y));
+		m.setValue(2, 1, 2.0f * (y * z + w * x));
+		m.setValue(2, 2, d + 2.0f * z * z);
+	}
+}
+
 void VisualActor::setAnimHandler(AnimHandler *animHandler) {
 	_animHandler = animHandler;
 }
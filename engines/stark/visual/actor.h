@@ -27,6 +27,7 @@
 #include "common/array.h"
 #include "common/rect.h"
 
+#include "math/matrix3.h"
 #include "math/matrix4.h"
 #include "math/ray.h"
 #include "math/vector3d.h"
@@ -79,8 +80,14 @@ protected:
 	bool _modelIsDirty;
 	bool _castsShadow;
 
+	/** The rotation of each bone of the model for the current frame */
+	Common::Array<Math::Matrix3> _boneRotations;
+
 	Math::Matrix4 getModelMatrix(const Math::Vector3d &position, float direction) const;
 	const Gfx::Texture *resolveTexture(const Material *material) const;
+
+	/** Convert the current bone rotations to matrices, which are cheaper to apply to many vertices */
+	void updateBoneRotations();
 };
 
 } // End of namespace Stark
@@ -60,6 +60,26 @@ const TeMaterial *TeMesh::material(uint index) const {
 	}
 }
 
+bool TeMesh::drawsSubsetNow(uint idx) {
+	return !hasAlpha(idx) || g_engine->getRenderer()->shadowMode() == TeRenderer::ShadowModeCreating || !_shouldDraw;
+}
+
+uint TeMesh::subsetRunEnd(uint first) {
+	// Subsets are stored one after the other in _indexes, so a run of
+	// them with the same material can go in a single draw call.
+	const TeMaterial &material = _materials[first];
+	uint end = first + 1;
+	while (end < _materials.size()) {
+		if (_faceCounts[end]) {
+			const TeMaterial &next = _materials[end];
+			if (next != material || next._isShadowTexture != material._isShadowTexture || !drawsSubsetNow(end))
+				break;
+		}
+		end++;
+	}
+	return end;
+}
+
 void TeMesh::destroy() {
 	_hasAlpha = false;
 	_updatedVerticies.clear();
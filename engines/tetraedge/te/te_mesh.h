@@ -123,6 +123,11 @@ public:
 	static TeMesh *makeInstance();
 
 protected:
+	// True if material subset idx is drawn directly rather than queued as transparent
+	bool drawsSubsetNow(uint idx);
+	// One past the last subset that can be drawn in the same call as first
+	uint subsetRunEnd(uint first);
+
 	Common::Array<unsigned char> _materialIndexes;
 	Common::Array<TeVector3f32> _verticies;
 	Common::Array<TeVector3f32> _normals;
@@ -125,13 +125,24 @@ void TeMeshOpenGL::draw() {
 		for (uint i = 0; i < _materials.size(); i++) {
 			if (!_faceCounts[i])
 				continue;
-			if (!hasAlpha(i) || renderer->shadowMode() == TeRenderer::ShadowModeCreating || !_shouldDraw) {
-				renderer->applyMaterial(_materials[i]);
-				glDrawElements(_glMeshMode, _faceCounts[i] * 3, GL_UNSIGNED_SHORT, _indexes.data() + totalFaceCount * 3);
-				glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-				renderer->disableTexture();
+			if (!drawsSubsetNow(i)) {
+				totalFaceCount += _faceCounts[i];
+				continue;
 			}
-			totalFaceCount += _faceCounts[i];
+
+			// Draw the following subsets with the same material along with this one
+			uint end = subsetRunEnd(i);
+			int faceCount = 0;
+			for (uint j = i; j < end; j++)
+				faceCount += _faceCounts[j];
+
+			renderer->applyMaterial(_materials[i]);
+			glDrawElements(_glMeshMode, faceCount * 3, GL_UNSIGNED_SHORT, _indexes.data() + totalFaceCount * 3);
+			glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+			renderer->disableTexture();
+
+			totalFaceCount += faceCount;
+			i = end - 1;
 		}
 	}
 
@@ -128,13 +128,24 @@ void TeMeshTinyGL::draw() {
 		for (uint i = 0; i < _materials.size(); i++) {
 			if (!_faceCounts[i])
 				continue;
-			if (!hasAlpha(i) || renderer->shadowMode() == TeRenderer::ShadowModeCreating || !_shouldDraw) {
-				renderer->applyMaterial(_materials[i]);
-				tglDrawElements(_glMeshMode, _faceCounts[i] * 3, TGL_UNSIGNED_SHORT, _indexes.data() + totalFaceCount * 3);
-				tglDisableClientState(TGL_TEXTURE_COORD_ARRAY);
-				renderer->disableTexture();
+			if (!drawsSubsetNow(i)) {
+				totalFaceCount += _faceCounts[i];
+				continue;
 			}
-			totalFaceCount += _faceCounts[i];
+
+			// Draw the following subsets with the same material along with this one
+			uint end = subsetRunEnd(i);
+			int faceCount = 0;
+			for (uint j = i; j < end; j++)
+				faceCount += _faceCounts[j];
+
+			renderer->applyMaterial(_materials[i]);
+			tglDrawElements(_glMeshMode, faceCount * 3, TGL_UNSIGNED_SHORT, _indexes.data() + totalFaceCount * 3);
+			tglDisableClientState(TGL_TEXTURE_COORD_ARRAY);
+			renderer->disableTexture();
+
+			totalFaceCount += faceCount;
+			i = end - 1;
 		}
 	}
 
@@ -30,6 +30,14 @@
 
 namespace Tetraedge {
 
+/** Milliseconds per frame spent decoding warp blocs that are out of view. */
+static const uint32 kOffscreenBlocLoadBudget = 8;
+
+static bool isBlocInFrustum(const TeFrustum &frustum, const TeWarpBloc &b) {
+	return frustum.isTriangleInside(b.vertex(0), b.vertex(1), b.vertex(3))
+		|| frustum.isTriangleInside(b.vertex(1), b.vertex(2), b.vertex(3));
+}
+
 /*static*/
 bool TeWarp::debug = false;
 
@@ -417,7 +425,18 @@ void TeWarp::update() {
 		return;
 	//Application *app = g_engine->getApplication();
 	_frustum.update(_camera);
+
+	// Only the blocs in view are needed for this frame.  The rest of the
+	// panorama is streamed in over the next frames, so entering a warp
+	// doesn't stall until every face has been decoded.
+	const uint32 startTime = g_system->getMillis();
 	for (auto &bloc : _warpBlocs) {
+		if (!bloc.isLoaded() && isBlocInFrustum(_frustum, bloc))
+			bloc.loadTexture(*_file, _texEncodingType);
+	}
+	for (auto &bloc : _warpBlocs) {
+		if (g_system->getMillis() - startTime >= kOffscreenBlocLoadBudget)
+			break;
 		bloc.loadTexture(*_file, _texEncodingType);
 	}
 
@@ -554,7 +573,9 @@ void TeWarp::render() {
 
 	if (_renderWarpBlocs) {
 		for (auto &bloc : _warpBlocs) {
-			bloc.render();
+			// Blocs still waiting to be streamed in are off-screen
+			if (bloc.isLoaded())
+				bloc.render();
 		}
 	}
 
@@ -563,10 +584,8 @@ void TeWarp::render() {
 			continue;
 		for (FrameData &frameData : animData->_frameDatas) {
 			for (TeWarpBloc &b : frameData._warpBlocs) {
-				if (_frustum.isTriangleInside(b.vertex(0), b.vertex(1), b.vertex(3))
-						|| _frustum.isTriangleInside(b.vertex(1), b.vertex(2), b.vertex(3))) {
+				if (isBlocInFrustum(_frustum, b))
 					b.render();
-				}
 			}
 		}
 	}
@@ -666,10 +685,8 @@ void TeWarp::updateCamera(const TeVector3f32 &screen) {
 
 void TeWarp::FrameData::loadTextures(const TeFrustum &frustum, Common::SeekableReadStream &file, const Common::String &fileType) {
 	for (auto &b : _warpBlocs) {
-		if (!b.isLoaded() && (frustum.isTriangleInside(b.vertex(0), b.vertex(1), b.vertex(3))
-				|| frustum.isTriangleInside(b.vertex(1), b.vertex(2), b.vertex(3)))) {
+		if (!b.isLoaded() && isBlocInFrustum(frustum, b))
 			b.loadTexture(file, fileType);
-		}
 	}
 }
 
@@ -55,6 +55,7 @@ CurrentMap::CurrentMap() : _currentMap(0), _eggHatcher(0),
 	  _fastXMin(-1), _fastYMin(-1), _fastXMax(-1), _fastYMax(-1) {
 	for (unsigned int i = 0; i < MAP_NUM_CHUNKS; i++) {
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
+		memset(_shapesWarm[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
 	}
 
 	if (GAME_IS_U8) {
@@ -83,6 +84,7 @@ void CurrentMap::clear() {
 			_items[i][j].clear();
 		}
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
+		memset(_shapesWarm[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
 	}
 
 	_fastXMin =  _fastYMin = _fastXMax = _fastYMax = -1;
@@ -184,6 +186,7 @@ void CurrentMap::loadMap(Map *map) {
 	// Clear fast area
 	for (unsigned int i = 0; i < MAP_NUM_CHUNKS; i++) {
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
+		memset(_shapesWarm[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
 	}
 	_fastXMin = -1;
 	_fastYMin = -1;
@@ -501,6 +504,33 @@ void CurrentMap::updateFastArea(const Point3 &from, const Point3 &to) {
 			else setChunkFast(cx, cy);
 		}
 	}
+
+	warmShapesAround(x_min, x_max, y_min, y_max);
+}
+
+void CurrentMap::warmShapesAround(int minx, int maxx, int miny, int maxy) {
+	// One chunk beyond the coarse fast area limits is enough to stay ahead
+	// of scrolling. Shapes stay loaded once cached, so each chunk only needs
+	// to be visited once per map.
+	minx--;
+	maxx++;
+	miny--;
+	maxy++;
+	clipMapChunks(minx, maxx, miny, maxy);
+
+	for (int32 cy = miny; cy <= maxy; cy++) {
+		for (int32 cx = minx; cx <= maxx; cx++) {
+			uint32 &warm = _shapesWarm[cy][cx / 32];
+			const uint32 bit = 1 << (cx & 31);
+			if (warm & bit)
+				continue;
+			warm |= bit;
+
+			for (const auto *item : _items[cx][cy]) {
+				item->getShapeObject();
+			}
+		}
+	}
 }
 
 void CurrentMap::setChunkFast(int32 cx, int32 cy) {
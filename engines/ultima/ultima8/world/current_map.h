@@ -211,6 +211,9 @@ private:
 	uint32 _fast[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS / 32];
 	int32 _fastXMin, _fastYMin, _fastXMax, _fastYMax;
 
+	// Chunks whose item shapes have already been loaded, same layout as _fast
+	uint32 _shapesWarm[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS / 32];
+
 	int _mapChunkSize;
 
 	//! Items that are "targetable" in Crusader. It might be faster to store
@@ -219,6 +222,10 @@ private:
 
 	void setChunkFast(int32 cx, int32 cy);
 	void unsetChunkFast(int32 cx, int32 cy);
+
+	//! Load the shapes of all items in the chunks just outside the given
+	//! fast area limits, so they don't have to be loaded while painting
+	void warmShapesAround(int minx, int maxx, int miny, int maxy);
 };
 
 } // End of namespace Ultima8
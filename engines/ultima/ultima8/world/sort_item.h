@@ -188,6 +188,16 @@ struct SortItem {
 			unused = unused->_next;
 			nn->val = other;
 
+			// Items are mostly added in list order, so check the end first
+			// to avoid walking long dependency lists
+			if (tail && !other->listLessThan(*(tail->val))) {
+				tail->_next = nn;
+				nn->_next = nullptr;
+				nn->_prev = tail;
+				tail = nn;
+				return;
+			}
+
 			for (Node *n = list; n != nullptr; n = n->_next) {
 				// Get the insert point... which is before the first item that has higher z than us
 				if (other->listLessThan(*(n->val))) {
@@ -40,6 +40,8 @@
 #include "common/config-manager.h"
 
 #define DIRTY_RECT_LIMIT 800
+// Past this many separate dirty rects, their bounding box is redrawn instead
+#define DIRTY_RECT_COUNT_LIMIT 16
 
 namespace Wintermute {
 
@@ -57,7 +59,6 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -75,8 +76,6 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
-
 	_renderSurface->free();
 	delete _renderSurface;
 	_blankSurface->free();
@@ -158,8 +157,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -198,9 +196,7 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -382,12 +378,41 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirtyRect(rect);
+	dirtyRect.clip(_renderRect);
+	if (dirtyRect.isEmpty()) {
+		return;
+	}
+
+	// Merge with the rects it overlaps. The merged rect may now overlap
+	// rects that were already checked, so start over.
+	uint i = 0;
+	while (i < _dirtyRects.size()) {
+		if (_dirtyRects[i].intersects(dirtyRect)) {
+			dirtyRect.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+
+	if (_dirtyRects.size() >= DIRTY_RECT_COUNT_LIMIT) {
+		for (i = 0; i < _dirtyRects.size(); ++i) {
+			dirtyRect.extend(_dirtyRects[i]);
+		}
+		_dirtyRects.clear();
 	}
-	_dirtyRect->clip(_renderRect);
+	_dirtyRects.push_back(dirtyRect);
+}
+
+static bool isOpaqueOver(const RenderTicket *ticket, const Common::Rect &rect) {
+	// A colour mod with alpha is still blended even with the alpha channel
+	// disabled, e.g. when fading an opaque background in or out
+	return ticket->_owner && ticket->_transform._alphaDisable &&
+	       ticket->_transform._rgbaMod == 0xFFFFFFFF &&
+	       ticket->_transform._blendMode == Graphics::BLEND_NORMAL &&
+	       ticket->_dstRect.contains(rect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -406,7 +431,7 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -416,43 +441,50 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
-	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
-	// the background color. Typical use-case: Fullscreen FMVs.
-	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+	for (uint i = 0; i < _dirtyRects.size(); ++i) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+
+		// Nothing below the last opaque ticket covering the whole dirty rect
+		// can show through, so start drawing from it. Typical use-case:
+		// Fullscreen FMVs, and opaque backgrounds.
+		RenderQueueIterator first = _renderQueue.begin();
+		bool covered = false;
+		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			if (isOpaqueOver(*it, dirtyRect)) {
+				first = it;
+				covered = true;
+			}
+		}
+		if (!covered) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
-	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+
+		for (it = first; it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (ticket->_dstRect.intersects(dirtyRect)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRect);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+			}
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
-		ticket->_wantsDraw = false;
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+	}
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -30,6 +30,7 @@
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 #include "common/list.h"
 
@@ -129,7 +130,11 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	/**
+	 * The areas of the screen to redraw this frame. They never overlap, so
+	 * no pixel is drawn twice when several separate areas change.
+	 */
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
 
 	bool _needsFlip;
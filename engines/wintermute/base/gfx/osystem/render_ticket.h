@@ -28,7 +28,7 @@
 #ifndef WINTERMUTE_RENDER_TICKET_H
 #define WINTERMUTE_RENDER_TICKET_H
 
-#include "graphics/surface.h"
+#include "graphics/managed_surface.h"
 
 #include "common/rect.h"
 
@@ -53,11 +53,11 @@ public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
 	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
 	~RenderTicket();
-	const Graphics::Surface *getSurface() const { return _surface; }
+	const Graphics::Surface *getSurface() const { return &_surface.rawSurface(); }
 	// Non-dirty-rects:
-	void drawToSurface(Graphics::Surface *_targetSurface) const;
+	void drawToSurface(Graphics::Surface *_targetSurface);
 	// Dirty-rects:
-	void drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect) const;
+	void drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect);
 
 	Common::Rect _dstRect;
 
@@ -70,7 +70,8 @@ public:
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
-	Graphics::Surface *_surface;
+	// Kept as a ManagedSurface so it can be blended without another copy
+	Graphics::ManagedSurface _surface;
 	Common::Rect _srcRect;
 };
 
@@ -3,6 +3,19 @@
 #include "common/memstream.h"
 #include "common/substream.h"
 
+class PrefetchRecordingStream : public Common::MemoryReadStream {
+public:
+	PrefetchRecordingStream(const byte *dataPtr, uint32 dataSize) : Common::MemoryReadStream(dataPtr, dataSize), _offset(-1), _len(0) {}
+
+	void prefetch(int64 offset, uint32 len) override {
+		_offset = offset;
+		_len = len;
+	}
+
+	int64 _offset;
+	uint32 _len;
+};
+
 class SeekableSubReadStreamTestSuite : public CxxTest::TestSuite {
 	public:
 	void test_traverse() {
@@ -70,4 +83,29 @@ class SeekableSubReadStreamTestSuite : public CxxTest::TestSuite {
 		b = ssrs.readByte();
 		TS_ASSERT_EQUALS(b, 1);
 	}
+	void test_prefetch() {
+		byte contents[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		PrefetchRecordingStream ms(contents, 10);
+
+		Common::SeekableSubReadStream ssrs(&ms, 2, 8);
+		ssrs.seek(1, SEEK_SET);
+
+		ssrs.prefetch(3, 2);
+		TS_ASSERT_EQUALS(ms._offset, 5);
+		TS_ASSERT_EQUALS(ms._len, 2u);
+
+		// Ranges are clipped to the end of the substream
+		ssrs.prefetch(4, 100);
+		TS_ASSERT_EQUALS(ms._offset, 6);
+		TS_ASSERT_EQUALS(ms._len, 2u);
+
+		// Ranges outside of the substream are ignored
+		ms._offset = -1;
+		ssrs.prefetch(6, 1);
+		TS_ASSERT_EQUALS(ms._offset, -1);
+
+		// Prefetching never moves the stream
+		TS_ASSERT_EQUALS(ssrs.pos(), 1);
+		TS_ASSERT_EQUALS(ssrs.readByte(), 3);
+	}
 };
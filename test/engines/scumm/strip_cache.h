@@ -0,0 +1,78 @@
+#include <cxxtest/TestSuite.h>
+#include "engines/scumm/strip_cache.h"
+
+/**
+ * Test suite for the StripCache class in engines/scumm/strip_cache.h
+ */
+class StripCacheTestSuite : public CxxTest::TestSuite {
+	static const int kPitch = 16;
+	static const int kHeight = 4;
+
+	byte _src[2];
+	byte _decoded[kPitch * kHeight];
+	byte _screen[kPitch * kHeight];
+
+	public:
+	void setUp() {
+		for (int i = 0; i < kPitch * kHeight; i++) {
+			_decoded[i] = i;
+		}
+		memset(_screen, 0xFF, sizeof(_screen));
+	}
+
+	void test_miss_then_hit() {
+		Scumm::StripCache cache;
+		cache.setMaxSize(1024);
+
+		TS_ASSERT(!cache.fetch(&_src[0], _screen, kPitch, kHeight));
+		cache.store(&_src[0], _decoded, kPitch, kHeight);
+		TS_ASSERT_EQUALS(cache.getSize(), (uint32)(8 * kHeight));
+
+		TS_ASSERT(cache.fetch(&_src[0], _screen, kPitch, kHeight));
+		for (int y = 0; y < kHeight; y++) {
+			// Only the 8 pixels of the strip are copied
+			TS_ASSERT_SAME_DATA(_screen + y * kPitch, _decoded + y * kPitch, 8);
+			TS_ASSERT_EQUALS(_screen[y * kPitch + 8], 0xFF);
+		}
+		TS_ASSERT_EQUALS(cache.getHits(), 1u);
+		TS_ASSERT_EQUALS(cache.getMisses(), 1u);
+	}
+
+	void test_keys() {
+		Scumm::StripCache cache;
+		cache.setMaxSize(1024);
+		cache.store(&_src[0], _decoded, kPitch, kHeight);
+
+		// Another strip, or the same one drawn at another height, is a miss
+		TS_ASSERT(!cache.fetch(&_src[1], _screen, kPitch, kHeight));
+		TS_ASSERT(!cache.fetch(&_src[0], _screen, kPitch, kHeight - 1));
+	}
+
+	void test_flush() {
+		Scumm::StripCache cache;
+		cache.setMaxSize(1024);
+		cache.store(&_src[0], _decoded, kPitch, kHeight);
+
+		cache.flush();
+		TS_ASSERT_EQUALS(cache.getSize(), 0u);
+		TS_ASSERT_EQUALS(cache.getNumStrips(), 0u);
+		TS_ASSERT(!cache.fetch(&_src[0], _screen, kPitch, kHeight));
+	}
+
+	void test_budget() {
+		Scumm::StripCache cache;
+
+		// Disabled
+		cache.store(&_src[0], _decoded, kPitch, kHeight);
+		TS_ASSERT_EQUALS(cache.getNumStrips(), 0u);
+
+		// Room for a single strip: storing another one starts over
+		cache.setMaxSize(8 * kHeight);
+		cache.store(&_src[0], _decoded, kPitch, kHeight);
+		cache.store(&_src[1], _decoded, kPitch, kHeight);
+		TS_ASSERT_EQUALS(cache.getNumStrips(), 1u);
+		TS_ASSERT_EQUALS(cache.getSize(), (uint32)(8 * kHeight));
+		TS_ASSERT(!cache.fetch(&_src[0], _screen, kPitch, kHeight));
+		TS_ASSERT(cache.fetch(&_src[1], _screen, kPitch, kHeight));
+	}
+};
@@ -869,4 +869,35 @@ class U8SortItemTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT(!si1.overlap(si2));
 		TS_ASSERT(!si2.overlap(si1));
 	}
+
+	/* Dependencies should be kept in list order regardless of insertion order */
+	void test_depends_insert_sorted() {
+		Ultima::Ultima8::SortItem si1;
+		Ultima::Ultima8::SortItem si2;
+		Ultima::Ultima8::SortItem si3;
+		Ultima::Ultima8::SortItem si4;
+		Ultima::Ultima8::SortItem si5;
+
+		si1.setBoxBounds(Ultima::Ultima8::Box(0, 0, 0, 32, 32, 8), 0, 0);
+		si2.setBoxBounds(Ultima::Ultima8::Box(0, 0, 8, 32, 32, 8), 0, 0);
+		si3.setBoxBounds(Ultima::Ultima8::Box(0, 0, 16, 32, 32, 8), 0, 0);
+		si4.setBoxBounds(Ultima::Ultima8::Box(0, 0, 16, 32, 32, 8), 0, 0);
+		si5.setBoxBounds(Ultima::Ultima8::Box(0, 0, 24, 32, 32, 8), 0, 0);
+
+		si5._depends.insert_sorted(&si3);
+		si5._depends.insert_sorted(&si1);
+		si5._depends.insert_sorted(&si4);
+		si5._depends.insert_sorted(&si2);
+
+		// Equal items keep their insertion order
+		Ultima::Ultima8::SortItem *expected[] = { &si1, &si2, &si3, &si4 };
+		int i = 0;
+		for (Ultima::Ultima8::SortItem *si : si5._depends) {
+			TS_ASSERT(i < 4);
+			if (i < 4)
+				TS_ASSERT(si == expected[i]);
+			i++;
+		}
+		TS_ASSERT(i == 4);
+	}
 };
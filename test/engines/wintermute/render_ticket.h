@@ -0,0 +1,67 @@
+#include <cxxtest/TestSuite.h>
+#include "engines/wintermute/base/gfx/osystem/render_ticket.h"
+
+#include "graphics/blit.h"
+#include "graphics/transform_struct.h"
+
+/**
+ * Test suite for the RenderTicket class in
+ * engines/wintermute/base/gfx/osystem/render_ticket.h
+ */
+class RenderTicketTestSuite : public CxxTest::TestSuite {
+	Graphics::Surface _src;
+	Graphics::Surface _dst;
+
+	public:
+	void setUp() {
+		const Graphics::PixelFormat format = Graphics::BlendBlit::getSupportedPixelFormat();
+		_src.create(8, 8, format);
+		_dst.create(8, 8, format);
+		for (int y = 0; y < _src.h; y++) {
+			for (int x = 0; x < _src.w; x++) {
+				_src.setPixel(x, y, format.ARGBToColor(255, x * 32, y * 32, 128));
+			}
+		}
+		_dst.fillRect(Common::Rect(_dst.w, _dst.h), 0);
+	}
+
+	void tearDown() {
+		_src.free();
+		_dst.free();
+	}
+
+	void test_clipped_copy() {
+		Common::Rect srcRect(2, 3, 6, 7);
+		Common::Rect dstRect(1, 1, 5, 5);
+		Wintermute::RenderTicket ticket(nullptr, &_src, &srcRect, &dstRect, Graphics::TransformStruct());
+
+		const Graphics::Surface *surface = ticket.getSurface();
+		TS_ASSERT_EQUALS(surface->w, 4);
+		TS_ASSERT_EQUALS(surface->h, 4);
+		for (int y = 0; y < 4; y++) {
+			for (int x = 0; x < 4; x++) {
+				TS_ASSERT_EQUALS(surface->getPixel(x, y), _src.getPixel(srcRect.left + x, srcRect.top + y));
+			}
+		}
+	}
+
+	void test_draw_is_repeatable() {
+		Common::Rect srcRect(2, 3, 6, 7);
+		Common::Rect dstRect(1, 1, 5, 5);
+		Wintermute::RenderTicket ticket(nullptr, &_src, &srcRect, &dstRect, Graphics::TransformStruct());
+
+		// Tickets are kept from one frame to the next and drawn again
+		for (int i = 0; i < 2; i++) {
+			ticket.drawToSurface(&_dst);
+			for (int y = 0; y < _dst.h; y++) {
+				for (int x = 0; x < _dst.w; x++) {
+					if (dstRect.contains(x, y)) {
+						TS_ASSERT_EQUALS(_dst.getPixel(x, y), _src.getPixel(x - dstRect.left + srcRect.left, y - dstRect.top + srcRect.top));
+					} else {
+						TS_ASSERT_EQUALS(_dst.getPixel(x, y), 0u);
+					}
+				}
+			}
+		}
+	}
+};
@@ -30,6 +30,11 @@ endif
 
 TEST_LIBS +=	audio/libaudio.a math/libmath.a common/formats/libformats.a common/compression/libcompression.a common/libcommon.a image/libimage.a graphics/libgraphics.a
 
+ifeq ($(ENABLE_SCUMM), STATIC_PLUGIN)
+	TESTS += $(srcdir)/test/engines/scumm/*.h
+	TEST_LIBS += engines/scumm/libscumm.a
+endif
+
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
 	TEST_LIBS += engines/wintermute/libwintermute.a